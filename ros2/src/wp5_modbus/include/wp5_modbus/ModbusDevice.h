@@ -0,0 +1,64 @@
+/**
+ * @file ModbusDevice.h
+ * @brief Modbus TCP connection to one device, reading and writing blocks of registers.
+ *
+ * Thin layer over libmodbus, free of ROS so that the driver component only handles the topics. Registers are read
+ * straight into the buffer given by the caller, the loaned message of a snapshot, so no copy is made between the
+ * response of the device and the middleware. A TCP connection serves one request at a time, so requests from several
+ * threads are serialized, and a failed request drops the connection to reconnect on the next one.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+struct _modbus;
+
+namespace wp5_modbus {
+
+enum class RegisterType { HOLDING, INPUT };
+
+struct ModbusParameters {
+  std::string host = "127.0.0.1";
+  int port = 502;
+  int slaveId = 1;
+  double responseTimeout = 0.05; // [s]
+};
+
+class ModbusDevice {
+public:
+  static constexpr std::uint16_t MAX_READ_REGISTERS = 125;
+
+  explicit ModbusDevice(const ModbusParameters& params);
+  ~ModbusDevice();
+
+  ModbusDevice(const ModbusDevice&) = delete;
+  ModbusDevice& operator=(const ModbusDevice&) = delete;
+
+  /**
+   * @brief Read count registers from address into registers, throws std::runtime_error when the request fails.
+   */
+  void read(RegisterType type, std::uint16_t address, std::uint16_t count, std::uint16_t* registers);
+
+  /**
+   * @brief Write consecutive holding registers from address, throws std::runtime_error when the request fails.
+   */
+  void write(std::uint16_t address, const std::vector<std::uint16_t>& values);
+
+private:
+  void connect_();
+  [[noreturn]] void fail_(const std::string& request);
+
+  ModbusParameters params_;
+  std::mutex mutex_;
+  _modbus* context_ = nullptr;
+  bool connected_ = false;
+};
+
+} // namespace wp5_modbus
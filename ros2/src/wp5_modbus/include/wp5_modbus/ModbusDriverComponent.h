@@ -0,0 +1,79 @@
+/**
+ * @file ModbusDriverComponent.h
+ * @brief rclcpp component polling register blocks of a Modbus device into snapshots, and writing its registers.
+ *
+ * Each block of registers is read at the polling rate and published on <device>/<block> as a
+ * wp5_modbus/RegisterSnapshot, of fixed size. Loaded in a container with intra-process communication, snapshots are
+ * handed over to the other components as unique pointers, without copy nor serialization. Otherwise, when the
+ * middleware can loan messages, as Cyclone DDS over shared memory, snapshots are read straight into loaned messages and
+ * reach the other processes without copy either. Loans and intra-process communication are not combined, a loaned
+ * message bypasses the intra-process subscribers.
+ *
+ * Polling runs in its own callback group, spun by a single-threaded executor on a thread of the component, so that the
+ * other components of the container never delay it. The writes received on modbus_write are queued in the same group
+ * and sent between two polls, the device serving one request at a time. That thread is pinned to the cores reserved by
+ * RT_CPUS with a SCHED_FIFO priority, see the thread placement of wp5_common. A block that cannot be read is published
+ * invalid, so a failure never silences the other blocks.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <rclcpp/rclcpp.hpp>
+#include <wp5_common/ThreadPlacement.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "wp5_modbus/ModbusDevice.h"
+#include "wp5_modbus/msg/modbus_write.hpp"
+#include "wp5_modbus/msg/register_snapshot.hpp"
+
+namespace wp5_modbus {
+
+class ModbusDriverComponent : public rclcpp::Node {
+public:
+  explicit ModbusDriverComponent(const rclcpp::NodeOptions& options);
+  ~ModbusDriverComponent() override;
+
+private:
+  struct RegisterBlock {
+    std::string name;
+    RegisterType type = RegisterType::HOLDING;
+    std::uint16_t address = 0;
+    std::uint16_t count = 0;
+    rclcpp::Publisher<msg::RegisterSnapshot>::SharedPtr publisher;
+    bool loaned = false; // Read into messages loaned by the middleware
+  };
+
+  RegisterBlock declareBlock_(const std::string& name);
+  wp5_common::ThreadPlacement declarePlacement_(const std::string& name);
+  void poll_();
+
+  /**
+   * @brief Fill the snapshot of a block, read from the device when request is set, invalid otherwise or on failure.
+   *
+   * @return Whether the block was read.
+   */
+  bool readBlock_(const RegisterBlock& block, const rclcpp::Time& stamp, bool request, msg::RegisterSnapshot& snapshot);
+
+  void writeCallback_(msg::ModbusWrite::UniquePtr msg);
+
+  std::string device_;
+  std::unique_ptr<ModbusDevice> modbus_;
+  std::vector<RegisterBlock> blocks_;
+  bool useLoans_ = false;
+
+  rclcpp::CallbackGroup::SharedPtr pollGroup_;
+  rclcpp::TimerBase::SharedPtr pollTimer_;
+  rclcpp::executors::SingleThreadedExecutor pollExecutor_;
+  std::thread pollThread_;
+  rclcpp::Subscription<msg::ModbusWrite>::SharedPtr writeSub_;
+};
+
+} // namespace wp5_modbus
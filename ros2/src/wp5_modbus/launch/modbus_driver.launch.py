@@ -0,0 +1,47 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+# Modbus driver component loaded in a multi-threaded container with intra-process communication.
+# Author: lmunier - <lmunier@protonmail.com>
+# Date: 2026-10-17
+#
+# The components processing the register snapshots are loaded in the same container, so that the snapshots are handed
+# over without copy. With intra_process:=false, the driver publishes loaned messages instead, for subscribers in other
+# processes on a shared memory middleware.
+
+import os
+
+from ament_index_python.packages import get_package_share_directory
+from launch import LaunchDescription
+from launch.actions import DeclareLaunchArgument
+from launch.substitutions import LaunchConfiguration
+from launch_ros.actions import ComposableNodeContainer
+from launch_ros.descriptions import ComposableNode
+from launch_ros.parameter_descriptions import ParameterValue
+
+
+def generate_launch_description():
+    default_config = os.path.join(get_package_share_directory("wp5_modbus"), "config", "modbus_driver.yaml")
+    config = LaunchConfiguration("config")
+    intra_process = LaunchConfiguration("intra_process")
+
+    driver = ComposableNode(
+        package="wp5_modbus",
+        plugin="wp5_modbus::ModbusDriverComponent",
+        name="modbus_driver",
+        parameters=[config],
+        extra_arguments=[{"use_intra_process_comms": ParameterValue(intra_process, value_type=bool)}],
+    )
+
+    return LaunchDescription([
+        DeclareLaunchArgument("config", default_value=default_config),
+        DeclareLaunchArgument("intra_process", default_value="true"),
+        ComposableNodeContainer(
+            name="modbus_container",
+            namespace="",
+            package="rclcpp_components",
+            executable="component_container_mt",
+            composable_node_descriptions=[driver],
+            output="screen",
+        ),
+    ])
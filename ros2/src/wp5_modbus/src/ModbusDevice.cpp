@@ -0,0 +1,82 @@
+/**
+ * @file ModbusDevice.cpp
+ * @brief Modbus TCP connection to one device, reading and writing blocks of registers.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include "wp5_modbus/ModbusDevice.h"
+
+#include <modbus/modbus.h>
+
+#include <cerrno>
+#include <cmath>
+#include <stdexcept>
+
+namespace wp5_modbus {
+
+ModbusDevice::ModbusDevice(const ModbusParameters& params) : params_(params) {
+  context_ = modbus_new_tcp(params_.host.c_str(), params_.port);
+  if (context_ == nullptr) {
+    throw std::runtime_error("[ModbusDevice] - Cannot create the context of " + params_.host + ": " +
+                             modbus_strerror(errno) + ".");
+  }
+  modbus_set_slave(context_, params_.slaveId);
+
+  const double seconds = std::floor(params_.responseTimeout);
+  modbus_set_response_timeout(context_,
+                              static_cast<std::uint32_t>(seconds),
+                              static_cast<std::uint32_t>((params_.responseTimeout - seconds) * 1e6));
+}
+
+ModbusDevice::~ModbusDevice() {
+  if (connected_) {
+    modbus_close(context_);
+  }
+  modbus_free(context_);
+}
+
+void ModbusDevice::read(RegisterType type, std::uint16_t address, std::uint16_t count, std::uint16_t* registers) {
+  if (count > MAX_READ_REGISTERS) {
+    throw std::invalid_argument("[ModbusDevice] - At most " + std::to_string(MAX_READ_REGISTERS) +
+                                " registers per read, got " + std::to_string(count) + ".");
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  connect_();
+  const int nbRead = type == RegisterType::HOLDING ? modbus_read_registers(context_, address, count, registers)
+                                                   : modbus_read_input_registers(context_, address, count, registers);
+  if (nbRead != count) {
+    fail_("Read of " + std::to_string(count) + " registers at " + std::to_string(address));
+  }
+}
+
+void ModbusDevice::write(std::uint16_t address, const std::vector<std::uint16_t>& values) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  connect_();
+  const int nbWritten = modbus_write_registers(context_, address, static_cast<int>(values.size()), values.data());
+  if (nbWritten != static_cast<int>(values.size())) {
+    fail_("Write of " + std::to_string(values.size()) + " registers at " + std::to_string(address));
+  }
+}
+
+void ModbusDevice::connect_() {
+  if (connected_) {
+    return;
+  }
+  if (modbus_connect(context_) != 0) {
+    throw std::runtime_error("[ModbusDevice] - Cannot connect to " + params_.host + ":" + std::to_string(params_.port) +
+                             ": " + modbus_strerror(errno) + ".");
+  }
+  connected_ = true;
+}
+
+void ModbusDevice::fail_(const std::string& request) {
+  const std::string error = modbus_strerror(errno);
+  modbus_close(context_);
+  connected_ = false;
+  throw std::runtime_error("[ModbusDevice] - " + request + " of " + params_.host + " failed: " + error + ".");
+}
+
+} // namespace wp5_modbus
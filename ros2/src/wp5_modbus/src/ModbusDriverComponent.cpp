@@ -0,0 +1,175 @@
+/**
+ * @file ModbusDriverComponent.cpp
+ * @brief rclcpp component polling register blocks of a Modbus device into snapshots, and writing its registers.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include "wp5_modbus/ModbusDriverComponent.h"
+
+#include <rclcpp_components/register_node_macro.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+
+namespace wp5_modbus {
+
+ModbusDriverComponent::ModbusDriverComponent(const rclcpp::NodeOptions& options) : Node("modbus_driver", options) {
+  device_ = declare_parameter<std::string>("device", "welder");
+
+  ModbusParameters params;
+  params.host = declare_parameter<std::string>("host", params.host);
+  params.port = static_cast<int>(declare_parameter<std::int64_t>("port", params.port));
+  params.slaveId = static_cast<int>(declare_parameter<std::int64_t>("slave_id", params.slaveId));
+  params.responseTimeout = declare_parameter<double>("response_timeout", params.responseTimeout);
+  modbus_ = std::make_unique<ModbusDevice>(params);
+
+  const double rate = declare_parameter<double>("rate", 100.0);
+  if (rate <= 0.0) {
+    throw std::invalid_argument("[ModbusDriverComponent] - Polling rate must be positive.");
+  }
+
+  for (const std::string& name : declare_parameter<std::vector<std::string>>("blocks", std::vector<std::string>())) {
+    blocks_.push_back(declareBlock_(name));
+  }
+
+  // A request timing out past the poll period would delay the next cycles
+  if (params.responseTimeout >= 1.0 / rate) {
+    RCLCPP_WARN_STREAM(get_logger(),
+                       "[ModbusDriverComponent] - Response timeout of " << params.responseTimeout
+                                                                        << " s longer than the polling period.");
+  }
+
+  // The poll group is left out of the executor of the container, it is spun on its own placed thread
+  pollGroup_ = create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive, false);
+  pollTimer_ = create_wall_timer(
+      std::chrono::duration<double>(1.0 / rate), [this]() { poll_(); }, pollGroup_);
+  pollExecutor_.add_callback_group(pollGroup_, get_node_base_interface());
+
+  // Writes are queued by the poll executor and sent between two polls, the device serves one request at a time
+  rclcpp::SubscriptionOptions writeOptions;
+  writeOptions.callback_group = pollGroup_;
+  writeSub_ = create_subscription<msg::ModbusWrite>(
+      declare_parameter<std::string>("write_topic", "modbus_write"),
+      rclcpp::QoS(8),
+      [this](msg::ModbusWrite::UniquePtr msg) { writeCallback_(std::move(msg)); },
+      writeOptions);
+
+  // Started last, so that a failing constructor leaves no thread behind
+  const wp5_common::ThreadPlacement placement = declarePlacement_("poll_thread");
+  pollThread_ = std::thread([this, placement]() {
+    wp5_common::applyPlacement(pthread_self(), placement, "Modbus poll");
+    pollExecutor_.spin();
+  });
+
+  RCLCPP_INFO_STREAM(get_logger(),
+                     "[ModbusDriverComponent] - Polling " << blocks_.size() << " register blocks of " << device_
+                                                          << " at " << rate << " Hz, "
+                                                          << (useLoans_ ? "loaned messages." : "no loans."));
+}
+
+ModbusDriverComponent::~ModbusDriverComponent() {
+  pollExecutor_.cancel();
+  if (pollThread_.joinable()) {
+    pollThread_.join();
+  }
+}
+
+wp5_common::ThreadPlacement ModbusDriverComponent::declarePlacement_(const std::string& name) {
+  wp5_common::ThreadPlacement placement;
+  placement.priority = static_cast<int>(declare_parameter<std::int64_t>(name + ".priority", placement.priority));
+
+  const std::vector<std::int64_t> cpus =
+      declare_parameter<std::vector<std::int64_t>>(name + ".cpus", std::vector<std::int64_t>());
+  placement.cpus.assign(cpus.begin(), cpus.end());
+  if (placement.cpus.empty()) {
+    placement.cpus = wp5_common::reservedCpus();
+  }
+  return placement;
+}
+
+ModbusDriverComponent::RegisterBlock ModbusDriverComponent::declareBlock_(const std::string& name) {
+  RegisterBlock block;
+  block.name = name;
+
+  const std::string type = declare_parameter<std::string>(name + ".type", "holding");
+  if (type != "holding" && type != "input") {
+    throw std::invalid_argument("[ModbusDriverComponent] - Block " + name + " of unknown register type " + type + ".");
+  }
+  block.type = type == "input" ? RegisterType::INPUT : RegisterType::HOLDING;
+
+  const std::int64_t address = declare_parameter<std::int64_t>(name + ".address", 0);
+  const std::int64_t count = declare_parameter<std::int64_t>(name + ".count", 1);
+  if (address < 0 || address > 0xFFFF || count < 1 || count > ModbusDevice::MAX_READ_REGISTERS) {
+    throw std::invalid_argument("[ModbusDriverComponent] - Block " + name + " out of the registers of a read request.");
+  }
+  block.address = static_cast<std::uint16_t>(address);
+  block.count = static_cast<std::uint16_t>(count);
+
+  block.publisher = create_publisher<msg::RegisterSnapshot>(device_ + "/" + name, rclcpp::QoS(8));
+
+  // A loaned message bypasses the intra-process subscribers, the composition relies on intra-process instead
+  block.loaned = !get_node_options().use_intra_process_comms() && block.publisher->can_loan_messages();
+  useLoans_ = useLoans_ || block.loaned;
+  return block;
+}
+
+void ModbusDriverComponent::poll_() {
+  const rclcpp::Time stamp = now();
+
+  // After a failure the connection is dropped, the next blocks are published invalid rather than waiting for as many
+  // timeouts, and read again on the next cycle
+  bool connected = true;
+  for (const RegisterBlock& block : blocks_) {
+    if (block.loaned) {
+      auto snapshot = block.publisher->borrow_loaned_message();
+      connected = readBlock_(block, stamp, connected, snapshot.get());
+      block.publisher->publish(std::move(snapshot));
+    } else {
+      auto snapshot = std::make_unique<msg::RegisterSnapshot>();
+      connected = readBlock_(block, stamp, connected, *snapshot);
+      block.publisher->publish(std::move(snapshot));
+    }
+  }
+}
+
+bool ModbusDriverComponent::readBlock_(const RegisterBlock& block,
+                                       const rclcpp::Time& stamp,
+                                       bool request,
+                                       msg::RegisterSnapshot& snapshot) {
+  snapshot.stamp = stamp;
+  snapshot.address = block.address;
+  snapshot.count = block.count;
+  snapshot.valid = false;
+
+  if (request) {
+    try {
+      modbus_->read(block.type, block.address, block.count, snapshot.registers.data());
+      snapshot.valid = true;
+    } catch (const std::runtime_error& e) {
+      RCLCPP_WARN_STREAM_THROTTLE(get_logger(), *get_clock(), 1000, e.what());
+    }
+  }
+
+  // A loaned message is not initialized by the middleware
+  std::fill(snapshot.registers.begin() + (snapshot.valid ? block.count : 0), snapshot.registers.end(), 0);
+  return snapshot.valid;
+}
+
+void ModbusDriverComponent::writeCallback_(msg::ModbusWrite::UniquePtr msg) {
+  if (msg->device != device_ || msg->values.empty()) {
+    return;
+  }
+
+  try {
+    modbus_->write(msg->address, msg->values);
+  } catch (const std::runtime_error& e) {
+    RCLCPP_ERROR_STREAM(get_logger(), e.what());
+  }
+}
+
+} // namespace wp5_modbus
+
+RCLCPP_COMPONENTS_REGISTER_NODE(wp5_modbus::ModbusDriverComponent)
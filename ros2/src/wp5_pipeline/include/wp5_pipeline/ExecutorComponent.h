@@ -0,0 +1,48 @@
+/**
+ * @file ExecutorComponent.h
+ * @brief rclcpp component executing the replanned layers on the path controller and reporting them done.
+ *
+ * Each planned layer is forwarded to the path controller on path, moved out of the received message rather than
+ * copied, and reported on layer_done once its duration and the settle time have elapsed, which releases the next
+ * layer from the slicer. A layer received while another one runs replaces it, as the controller does.
+ *
+ * The execution is open loop: layer_done is driven by a timer on the node clock, not by the trajectory clock of the
+ * controller, so a path dropped by the bridge or started late by the controller still reports its layer done on time.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <rclcpp/rclcpp.hpp>
+#include <std_msgs/msg/u_int32.hpp>
+#include <trajectory_msgs/msg/multi_dof_joint_trajectory.hpp>
+
+#include <cstdint>
+
+#include "wp5_pipeline/msg/planned_layer.hpp"
+
+namespace wp5_pipeline {
+
+class ExecutorComponent : public rclcpp::Node {
+public:
+  explicit ExecutorComponent(const rclcpp::NodeOptions& options);
+
+private:
+  void plannedCallback_(msg::PlannedLayer::UniquePtr planned);
+  void layerDone_();
+
+  double settleTime_ = 0.5; // [s]
+
+  bool executing_ = false;
+  std::uint32_t currentLayer_ = 0;
+  rclcpp::TimerBase::SharedPtr doneTimer_;
+
+  rclcpp::CallbackGroup::SharedPtr executionGroup_;
+  rclcpp::Subscription<msg::PlannedLayer>::SharedPtr plannedSub_;
+  rclcpp::Publisher<trajectory_msgs::msg::MultiDOFJointTrajectory>::SharedPtr pathPub_;
+  rclcpp::Publisher<std_msgs::msg::UInt32>::SharedPtr layerDonePub_;
+};
+
+} // namespace wp5_pipeline
@@ -0,0 +1,55 @@
+/**
+ * @file LayerSlicer.h
+ * @brief Slicing of a wall extruded from a closed contour into layer paths of the torch.
+ *
+ * Each layer follows the contour at its own height, its vertices kept and its edges resampled at the waypoint spacing,
+ * closed back on its start. The start of each layer is shifted along the contour, so that the arc starts and stops,
+ * higher than the rest of the bead, do not pile up at the same place. The slicer is free of ROS, the component only
+ * handles the topics.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstddef>
+#include <vector>
+
+namespace wp5_pipeline {
+
+struct SlicerParameters {
+  double firstHeight = 0.0;      // Height of the first layer in the part frame [m]
+  double layerHeight = 1.8e-3;   // [m]
+  std::size_t nbLayers = 10;
+  double waypointSpacing = 1e-3; // [m]
+  double startShift = 0.01;      // Shift of the start of each layer along the contour [m]
+};
+
+class LayerSlicer {
+public:
+  /**
+   * @brief Slicer of the wall along contour, a closed polygon of at least three vertices, throws std::invalid_argument
+   * otherwise.
+   */
+  LayerSlicer(std::vector<Eigen::Vector2d> contour, const SlicerParameters& params);
+
+  /**
+   * @brief Torch positions of a layer in the part frame, from its start back to it.
+   */
+  std::vector<Eigen::Vector3d> slice(std::size_t index) const;
+
+  double layerHeight(std::size_t index) const { return params_.firstHeight + index * params_.layerHeight; }
+  std::size_t getNbLayers() const { return params_.nbLayers; }
+
+private:
+  // Point of the contour at a distance along it from its first vertex
+  Eigen::Vector2d pointAt_(double distance) const;
+
+  std::vector<Eigen::Vector2d> contour_;
+  std::vector<double> cumulativeLength_; // Along the contour at each vertex, the closing edge included [m]
+  SlicerParameters params_;
+};
+
+} // namespace wp5_pipeline
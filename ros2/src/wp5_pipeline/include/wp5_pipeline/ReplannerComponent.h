@@ -0,0 +1,63 @@
+/**
+ * @file ReplannerComponent.h
+ * @brief rclcpp component replanning each sliced layer on the scanned height of the part.
+ *
+ * The vertical offsets of the bead measured by the scan component while a layer is deposited are collected, and their
+ * median shifts the next layer, so that the torch keeps its standoff as the part grows higher or lower than sliced.
+ * The shift is limited per layer and accumulated over the build. The layer is then expressed in the robot base frame
+ * and timed at the deposition speed, as the Cartesian path of the wp5_controllers path controller.
+ *
+ * Corrections are collected in their own callback group while a layer is replanned in another, so neither waits for
+ * the other on the multi-threaded executor.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <rclcpp/rclcpp.hpp>
+#include <tf2_ros/buffer.h>
+#include <tf2_ros/transform_listener.h>
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "wp5_pipeline/msg/layer.hpp"
+#include "wp5_pipeline/msg/path_correction.hpp"
+#include "wp5_pipeline/msg/planned_layer.hpp"
+
+namespace wp5_pipeline {
+
+class ReplannerComponent : public rclcpp::Node {
+public:
+  explicit ReplannerComponent(const rclcpp::NodeOptions& options);
+
+private:
+  void correctionCallback_(const msg::PathCorrection::ConstSharedPtr& msg);
+  void layerCallback_(msg::Layer::UniquePtr layer);
+  double takeHeightOffset_();
+
+  std::string baseFrame_;
+  std::string toolFrame_;
+  double minQuality_ = 0.2;
+  std::size_t minSamples_ = 10;
+  double maxStep_ = 1e-3; // Of the height offset per layer [m]
+
+  std::mutex mutex_;
+  std::vector<double> verticalOffsets_; // Of the layer being deposited, guarded by the mutex [m]
+  double heightOffset_ = 0.0;           // [m]
+
+  std::shared_ptr<tf2_ros::Buffer> tfBuffer_;
+  std::shared_ptr<tf2_ros::TransformListener> tfListener_;
+
+  rclcpp::CallbackGroup::SharedPtr correctionGroup_;
+  rclcpp::CallbackGroup::SharedPtr planGroup_;
+  rclcpp::Subscription<msg::PathCorrection>::SharedPtr correctionSub_;
+  rclcpp::Subscription<msg::Layer>::SharedPtr layerSub_;
+  rclcpp::Publisher<msg::PlannedLayer>::SharedPtr plannedPub_;
+};
+
+} // namespace wp5_pipeline
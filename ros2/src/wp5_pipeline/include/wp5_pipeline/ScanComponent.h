@@ -0,0 +1,56 @@
+/**
+ * @file ScanComponent.h
+ * @brief rclcpp component detecting the previous bead in the laser profiles, as the seam tracker of the ROS 1 cell.
+ *
+ * Profiles received on profile (sensor_msgs/PointCloud2) go through the crest detector of wp5_seam_tracking, and the
+ * filtered offset of the crest to its nominal position is published on path_correction, for the path controller and
+ * the replanner. Loaded in the container of the profiler driver, the profiles are shared without copy.
+ *
+ * Profiles are processed in their own mutually exclusive callback group: in order, and never delayed by the replanning
+ * running in the other threads of the executor.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <rclcpp/rclcpp.hpp>
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <string>
+#include <vector>
+
+#include "wp5_pipeline/msg/path_correction.hpp"
+#include "wp5_seam_tracking/CrestDetector.h"
+
+namespace wp5_pipeline {
+
+class ScanComponent : public rclcpp::Node {
+public:
+  explicit ScanComponent(const rclcpp::NodeOptions& options);
+
+private:
+  void profileCallback_(const sensor_msgs::msg::PointCloud2::ConstSharedPtr& msg);
+
+  std::string lateralAxis_ = "x";
+  std::string heightAxis_ = "z";
+  double lateralSign_ = 1.0;
+  double heightSign_ = -1.0;
+  double nominalLateral_ = 0.0; // [m]
+  double nominalHeight_ = 0.0;  // [m]
+  double filterGain_ = 0.5;
+
+  wp5_seam_tracking::CrestDetector detector_;
+  std::vector<double> lateral_;
+  std::vector<double> height_;
+  bool hasCorrection_ = false;
+  double lateralOffset_ = 0.0;  // Filtered [m]
+  double verticalOffset_ = 0.0; // Filtered [m]
+
+  rclcpp::CallbackGroup::SharedPtr profileGroup_;
+  rclcpp::Subscription<sensor_msgs::msg::PointCloud2>::SharedPtr profileSub_;
+  rclcpp::Publisher<msg::PathCorrection>::SharedPtr correctionPub_;
+};
+
+} // namespace wp5_pipeline
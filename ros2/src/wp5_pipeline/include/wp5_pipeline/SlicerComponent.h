@@ -0,0 +1,50 @@
+/**
+ * @file SlicerComponent.h
+ * @brief rclcpp component slicing the part and handing its layers to the replanner one at a time.
+ *
+ * The layers are sliced once when the build starts, on the start_build service, and the first one is published on
+ * layer. Each next layer is published when the executor reports the previous one done on layer_done, so the replanner
+ * always plans on the scan of the layer below.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <rclcpp/rclcpp.hpp>
+#include <std_msgs/msg/u_int32.hpp>
+#include <std_srvs/srv/trigger.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "wp5_pipeline/LayerSlicer.h"
+#include "wp5_pipeline/msg/layer.hpp"
+
+namespace wp5_pipeline {
+
+class SlicerComponent : public rclcpp::Node {
+public:
+  explicit SlicerComponent(const rclcpp::NodeOptions& options);
+
+private:
+  void startBuild_(const std_srvs::srv::Trigger::Request::SharedPtr request,
+                   std_srvs::srv::Trigger::Response::SharedPtr response);
+  void layerDoneCallback_(const std_msgs::msg::UInt32::SharedPtr msg);
+  void publishLayer_(std::size_t index);
+
+  std::unique_ptr<LayerSlicer> slicer_;
+  std::string frameId_;
+  double depositionSpeed_ = 0.01; // [m/s]
+
+  std::vector<std::vector<Eigen::Vector3d>> layers_;
+  std::size_t currentLayer_ = 0;
+
+  rclcpp::Publisher<msg::Layer>::SharedPtr layerPub_;
+  rclcpp::Subscription<std_msgs::msg::UInt32>::SharedPtr layerDoneSub_;
+  rclcpp::Service<std_srvs::srv::Trigger>::SharedPtr startService_;
+};
+
+} // namespace wp5_pipeline
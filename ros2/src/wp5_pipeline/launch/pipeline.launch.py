@@ -0,0 +1,53 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+# Deposition pipeline loaded as components in one multi-threaded container with intra-process communication.
+# Author: lmunier - <lmunier@protonmail.com>
+# Date: 2026-10-17
+#
+# Layers, profiles and planned paths are handed over between the components as unique pointers, without copy nor
+# serialization. Each component runs its heavy callbacks in its own callback group, so the threads of the executor
+# scan, replan and execute concurrently. Other components, such as the Modbus driver of wp5_modbus or the profiler
+# driver, can be loaded in the same container with ros2 component load.
+
+import os
+
+from ament_index_python.packages import get_package_share_directory
+from launch import LaunchDescription
+from launch.actions import DeclareLaunchArgument
+from launch.substitutions import LaunchConfiguration
+from launch_ros.actions import ComposableNodeContainer
+from launch_ros.descriptions import ComposableNode
+from launch_ros.parameter_descriptions import ParameterValue
+
+
+def generate_launch_description():
+    default_config = os.path.join(get_package_share_directory("wp5_pipeline"), "config", "pipeline.yaml")
+    config = LaunchConfiguration("config")
+    intra_process = [{"use_intra_process_comms": True}]
+
+    components = [
+        ComposableNode(package="wp5_pipeline", plugin="wp5_pipeline::SlicerComponent", name="slicer",
+                       parameters=[config], extra_arguments=intra_process),
+        ComposableNode(package="wp5_pipeline", plugin="wp5_pipeline::ScanComponent", name="scan",
+                       parameters=[config], remappings=[("profile", "profiler/profile")],
+                       extra_arguments=intra_process),
+        ComposableNode(package="wp5_pipeline", plugin="wp5_pipeline::ReplannerComponent", name="replanner",
+                       parameters=[config], extra_arguments=intra_process),
+        ComposableNode(package="wp5_pipeline", plugin="wp5_pipeline::ExecutorComponent", name="executor",
+                       parameters=[config], extra_arguments=intra_process),
+    ]
+
+    return LaunchDescription([
+        DeclareLaunchArgument("config", default_value=default_config),
+        DeclareLaunchArgument("threads", default_value="4", description="Threads of the executor, 0 for every core"),
+        ComposableNodeContainer(
+            name="pipeline_container",
+            namespace="",
+            package="rclcpp_components",
+            executable="component_container_mt",
+            parameters=[{"thread_num": ParameterValue(LaunchConfiguration("threads"), value_type=int)}],
+            composable_node_descriptions=components,
+            output="screen",
+        ),
+    ])
@@ -0,0 +1,72 @@
+/**
+ * @file ExecutorComponent.cpp
+ * @brief rclcpp component executing the replanned layers on the path controller and reporting them done.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include "wp5_pipeline/ExecutorComponent.h"
+
+#include <rclcpp_components/register_node_macro.hpp>
+
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace wp5_pipeline {
+
+ExecutorComponent::ExecutorComponent(const rclcpp::NodeOptions& options) : Node("executor", options) {
+  settleTime_ = declare_parameter<double>("settle_time", settleTime_);
+
+  pathPub_ = create_publisher<trajectory_msgs::msg::MultiDOFJointTrajectory>(
+      declare_parameter<std::string>("path_topic", "cartesian_path_controller/path"), rclcpp::QoS(1).reliable());
+  layerDonePub_ = create_publisher<std_msgs::msg::UInt32>("layer_done", rclcpp::QoS(8));
+
+  // The subscription and the timer of a layer share a mutually exclusive group, they never race on its state
+  executionGroup_ = create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+  rclcpp::SubscriptionOptions subscriptionOptions;
+  subscriptionOptions.callback_group = executionGroup_;
+  plannedSub_ = create_subscription<msg::PlannedLayer>(
+      "planned_layer",
+      rclcpp::QoS(1).reliable(),
+      [this](msg::PlannedLayer::UniquePtr planned) { plannedCallback_(std::move(planned)); },
+      subscriptionOptions);
+}
+
+void ExecutorComponent::plannedCallback_(msg::PlannedLayer::UniquePtr planned) {
+  if (planned->path.points.empty()) {
+    return;
+  }
+  if (executing_) {
+    RCLCPP_WARN_STREAM(get_logger(),
+                       "[ExecutorComponent] - Layer " << currentLayer_ << " replaced by layer " << planned->index
+                                                      << " before its end.");
+  }
+
+  const double duration = rclcpp::Duration(planned->path.points.back().time_from_start).seconds() + settleTime_;
+  currentLayer_ = planned->index;
+  executing_ = true;
+
+  pathPub_->publish(std::make_unique<trajectory_msgs::msg::MultiDOFJointTrajectory>(std::move(planned->path)));
+
+  // On the node clock, so that the layers follow the simulated time of the cell
+  doneTimer_ = rclcpp::create_timer(this,
+                                    get_clock(),
+                                    rclcpp::Duration::from_seconds(duration),
+                                    [this]() { layerDone_(); },
+                                    executionGroup_);
+}
+
+void ExecutorComponent::layerDone_() {
+  doneTimer_->cancel();
+  executing_ = false;
+
+  auto done = std::make_unique<std_msgs::msg::UInt32>();
+  done->data = currentLayer_;
+  layerDonePub_->publish(std::move(done));
+}
+
+} // namespace wp5_pipeline
+
+RCLCPP_COMPONENTS_REGISTER_NODE(wp5_pipeline::ExecutorComponent)
@@ -0,0 +1,82 @@
+/**
+ * @file LayerSlicer.cpp
+ * @brief Slicing of a wall extruded from a closed contour into layer paths of the torch.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include "wp5_pipeline/LayerSlicer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace wp5_pipeline {
+
+LayerSlicer::LayerSlicer(std::vector<Eigen::Vector2d> contour, const SlicerParameters& params)
+    : contour_(std::move(contour)), params_(params) {
+  if (contour_.size() < 3) {
+    throw std::invalid_argument("[LayerSlicer] - Contour of " + std::to_string(contour_.size()) +
+                                " vertices, at least 3 expected.");
+  }
+  if (params_.waypointSpacing <= 0.0 || params_.layerHeight <= 0.0) {
+    throw std::invalid_argument("[LayerSlicer] - Waypoint spacing and layer height must be positive.");
+  }
+
+  cumulativeLength_.resize(contour_.size() + 1, 0.0);
+  for (std::size_t i = 0; i < contour_.size(); ++i) {
+    const Eigen::Vector2d& next = contour_[(i + 1) % contour_.size()];
+    cumulativeLength_[i + 1] = cumulativeLength_[i] + (next - contour_[i]).norm();
+  }
+  if (cumulativeLength_.back() <= 0.0) {
+    throw std::invalid_argument("[LayerSlicer] - Contour of zero length.");
+  }
+}
+
+std::vector<Eigen::Vector3d> LayerSlicer::slice(std::size_t index) const {
+  const double length = cumulativeLength_.back();
+  const double start = std::fmod(index * params_.startShift, length);
+  const double z = layerHeight(index);
+
+  // Vertices passed from the start, so that every corner is a waypoint
+  std::vector<double> breaks{start};
+  for (std::size_t i = 0; i < contour_.size(); ++i) {
+    const double distance = cumulativeLength_[i] > start ? cumulativeLength_[i] : cumulativeLength_[i] + length;
+    breaks.push_back(distance);
+  }
+  breaks.push_back(start + length);
+  std::sort(breaks.begin(), breaks.end());
+
+  std::vector<Eigen::Vector3d> points;
+  for (std::size_t i = 0; i + 1 < breaks.size(); ++i) {
+    const double segment = breaks[i + 1] - breaks[i];
+    if (segment <= 0.0) {
+      continue;
+    }
+    const std::size_t nbSteps = static_cast<std::size_t>(std::ceil(segment / params_.waypointSpacing));
+    for (std::size_t j = 0; j < nbSteps; ++j) {
+      const Eigen::Vector2d point = pointAt_(std::fmod(breaks[i] + segment * j / nbSteps, length));
+      points.emplace_back(point.x(), point.y(), z);
+    }
+  }
+  const Eigen::Vector2d end = pointAt_(start);
+  points.emplace_back(end.x(), end.y(), z);
+  return points;
+}
+
+Eigen::Vector2d LayerSlicer::pointAt_(double distance) const {
+  const std::size_t edge = std::min<std::size_t>(
+      std::upper_bound(cumulativeLength_.begin(), cumulativeLength_.end(), distance) - cumulativeLength_.begin() - 1,
+      contour_.size() - 1);
+  const double edgeLength = cumulativeLength_[edge + 1] - cumulativeLength_[edge];
+  const double ratio = edgeLength > 0.0 ? (distance - cumulativeLength_[edge]) / edgeLength : 0.0;
+
+  const Eigen::Vector2d& from = contour_[edge];
+  const Eigen::Vector2d& to = contour_[(edge + 1) % contour_.size()];
+  return from + ratio * (to - from);
+}
+
+} // namespace wp5_pipeline
@@ -0,0 +1,138 @@
+/**
+ * @file ReplannerComponent.cpp
+ * @brief rclcpp component replanning each sliced layer on the scanned height of the part.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include "wp5_pipeline/ReplannerComponent.h"
+
+#include <rclcpp_components/register_node_macro.hpp>
+#include <tf2/exceptions.h>
+#include <tf2_eigen/tf2_eigen.hpp>
+
+#include <Eigen/Geometry>
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+namespace wp5_pipeline {
+
+ReplannerComponent::ReplannerComponent(const rclcpp::NodeOptions& options) : Node("replanner", options) {
+  baseFrame_ = declare_parameter<std::string>("base_frame", "base_link");
+  toolFrame_ = declare_parameter<std::string>("tool_frame", "tool0");
+  minQuality_ = declare_parameter<double>("min_quality", minQuality_);
+  minSamples_ = static_cast<std::size_t>(
+      declare_parameter<std::int64_t>("min_samples", static_cast<std::int64_t>(minSamples_)));
+  maxStep_ = declare_parameter<double>("max_step", maxStep_);
+
+  tfBuffer_ = std::make_shared<tf2_ros::Buffer>(get_clock());
+  tfListener_ = std::make_shared<tf2_ros::TransformListener>(*tfBuffer_);
+
+  plannedPub_ = create_publisher<msg::PlannedLayer>("planned_layer", rclcpp::QoS(1).reliable());
+
+  correctionGroup_ = create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+  rclcpp::SubscriptionOptions correctionOptions;
+  correctionOptions.callback_group = correctionGroup_;
+  correctionSub_ = create_subscription<msg::PathCorrection>(
+      "path_correction",
+      rclcpp::QoS(16),
+      [this](const msg::PathCorrection::ConstSharedPtr msg) { correctionCallback_(msg); },
+      correctionOptions);
+
+  planGroup_ = create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+  rclcpp::SubscriptionOptions planOptions;
+  planOptions.callback_group = planGroup_;
+  layerSub_ = create_subscription<msg::Layer>(
+      "layer",
+      rclcpp::QoS(1).reliable(),
+      [this](msg::Layer::UniquePtr layer) { layerCallback_(std::move(layer)); },
+      planOptions);
+}
+
+void ReplannerComponent::correctionCallback_(const msg::PathCorrection::ConstSharedPtr& msg) {
+  if (msg->quality < minQuality_) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  verticalOffsets_.push_back(msg->vertical);
+}
+
+void ReplannerComponent::layerCallback_(msg::Layer::UniquePtr layer) {
+  if (layer->waypoints.empty() || layer->deposition_speed <= 0.0) {
+    RCLCPP_ERROR_STREAM(get_logger(), "[ReplannerComponent] - Layer " << layer->index << " without path or speed.");
+    return;
+  }
+
+  Eigen::Isometry3d baseFromPart = Eigen::Isometry3d::Identity();
+  if (layer->header.frame_id != baseFrame_) {
+    try {
+      baseFromPart = tf2::transformToEigen(tfBuffer_->lookupTransform(
+          baseFrame_, layer->header.frame_id, tf2::TimePointZero, tf2::durationFromSec(0.5)));
+    } catch (const tf2::TransformException& e) {
+      RCLCPP_ERROR_STREAM(get_logger(),
+                          "[ReplannerComponent] - Layer " << layer->index << " not planned: " << e.what());
+      return;
+    }
+  }
+
+  // A new build starts back on the sliced heights
+  if (layer->index == 0) {
+    takeHeightOffset_();
+    heightOffset_ = 0.0;
+  }
+  const double heightOffset = takeHeightOffset_();
+
+  auto planned = std::make_unique<msg::PlannedLayer>();
+  planned->index = layer->index;
+  planned->height_offset = heightOffset;
+  trajectory_msgs::msg::MultiDOFJointTrajectory& path = planned->path;
+  path.header.stamp = now();
+  path.header.frame_id = baseFrame_;
+  path.joint_names = {toolFrame_};
+  path.points.resize(layer->waypoints.size());
+
+  double time = 0.0;
+  Eigen::Vector3d previous = Eigen::Vector3d::Zero();
+  for (std::size_t i = 0; i < layer->waypoints.size(); ++i) {
+    Eigen::Isometry3d waypoint;
+    tf2::fromMsg(layer->waypoints[i], waypoint);
+    waypoint.translation().z() += heightOffset;
+    waypoint = baseFromPart * waypoint;
+
+    if (i > 0) {
+      time += (waypoint.translation() - previous).norm() / layer->deposition_speed;
+    }
+    previous = waypoint.translation();
+
+    trajectory_msgs::msg::MultiDOFJointTrajectoryPoint& point = path.points[i];
+    point.transforms.resize(1);
+    point.transforms[0] = tf2::eigenToTransform(waypoint).transform;
+    point.time_from_start = rclcpp::Duration::from_seconds(time);
+  }
+
+  RCLCPP_INFO_STREAM(get_logger(),
+                     "[ReplannerComponent] - Layer " << layer->index << " raised by " << 1e3 * heightOffset
+                                                     << " mm, " << time << " s of deposition.");
+  plannedPub_->publish(std::move(planned));
+}
+
+double ReplannerComponent::takeHeightOffset_() {
+  std::vector<double> offsets;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    offsets.swap(verticalOffsets_);
+  }
+
+  if (offsets.size() >= minSamples_ && !offsets.empty()) {
+    const auto median = offsets.begin() + offsets.size() / 2;
+    std::nth_element(offsets.begin(), median, offsets.end());
+    heightOffset_ += std::clamp(*median, -maxStep_, maxStep_);
+  }
+  return heightOffset_;
+}
+
+} // namespace wp5_pipeline
+
+RCLCPP_COMPONENTS_REGISTER_NODE(wp5_pipeline::ReplannerComponent)
@@ -0,0 +1,126 @@
+/**
+ * @file ScanComponent.cpp
+ * @brief rclcpp component detecting the previous bead in the laser profiles, as the seam tracker of the ROS 1 cell.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include "wp5_pipeline/ScanComponent.h"
+
+#include <rclcpp_components/register_node_macro.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+
+namespace wp5_pipeline {
+
+namespace {
+
+std::size_t floatFieldOffset(const sensor_msgs::msg::PointCloud2& cloud, const std::string& name) {
+  for (const sensor_msgs::msg::PointField& field : cloud.fields) {
+    if (field.name != name) {
+      continue;
+    }
+    if (field.datatype != sensor_msgs::msg::PointField::FLOAT32 || field.offset + sizeof(float) > cloud.point_step) {
+      throw std::runtime_error("Field " + name + " is not a float32 of the points.");
+    }
+    return field.offset;
+  }
+  throw std::runtime_error("Field " + name + " does not exist.");
+}
+
+} // namespace
+
+ScanComponent::ScanComponent(const rclcpp::NodeOptions& options) : Node("scan", options) {
+  lateralAxis_ = declare_parameter<std::string>("lateral_axis", lateralAxis_);
+  heightAxis_ = declare_parameter<std::string>("height_axis", heightAxis_);
+  lateralSign_ = declare_parameter<double>("lateral_sign", lateralSign_);
+  heightSign_ = declare_parameter<double>("height_sign", heightSign_);
+  nominalLateral_ = declare_parameter<double>("nominal_lateral", nominalLateral_);
+  nominalHeight_ = declare_parameter<double>("nominal_height", nominalHeight_);
+  filterGain_ = std::clamp(declare_parameter<double>("filter_gain", filterGain_), 0.0, 1.0);
+
+  wp5_seam_tracking::CrestDetectorParameters params;
+  params.smoothingHalfWidth = static_cast<std::size_t>(declare_parameter<std::int64_t>(
+      "detector.smoothing_half_width", static_cast<std::int64_t>(params.smoothingHalfWidth)));
+  params.searchWindow = declare_parameter<double>("detector.search_window", params.searchWindow);
+  params.minProminence = declare_parameter<double>("detector.min_prominence", params.minProminence);
+  params.maxProminence = declare_parameter<double>("detector.max_prominence", params.maxProminence);
+  detector_ = wp5_seam_tracking::CrestDetector(params);
+
+  correctionPub_ = create_publisher<msg::PathCorrection>("path_correction", rclcpp::QoS(1));
+
+  profileGroup_ = create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+  rclcpp::SubscriptionOptions subscriptionOptions;
+  subscriptionOptions.callback_group = profileGroup_;
+  profileSub_ = create_subscription<sensor_msgs::msg::PointCloud2>(
+      "profile",
+      rclcpp::SensorDataQoS(),
+      [this](const sensor_msgs::msg::PointCloud2::ConstSharedPtr msg) { profileCallback_(msg); },
+      subscriptionOptions);
+}
+
+void ScanComponent::profileCallback_(const sensor_msgs::msg::PointCloud2::ConstSharedPtr& msg) {
+  const std::size_t nbPoints = static_cast<std::size_t>(msg->width) * msg->height;
+  lateral_.resize(nbPoints);
+  height_.resize(nbPoints);
+
+  try {
+    const std::size_t lateralOffset = floatFieldOffset(*msg, lateralAxis_);
+    const std::size_t heightOffset = floatFieldOffset(*msg, heightAxis_);
+    if (msg->row_step < static_cast<std::size_t>(msg->width) * msg->point_step ||
+        msg->data.size() < static_cast<std::size_t>(msg->row_step) * msg->height) {
+      throw std::runtime_error("Data shorter than the cloud dimensions.");
+    }
+
+    for (std::size_t row = 0; row < msg->height; ++row) {
+      const std::uint8_t* data = msg->data.data() + row * msg->row_step;
+      for (std::size_t i = 0; i < msg->width; ++i) {
+        float x = 0.0F;
+        float z = 0.0F;
+        std::memcpy(&x, data + i * msg->point_step + lateralOffset, sizeof(float));
+        std::memcpy(&z, data + i * msg->point_step + heightOffset, sizeof(float));
+        lateral_[row * msg->width + i] = x;
+        height_[row * msg->width + i] =
+            std::isfinite(z) ? heightSign_ * z : std::numeric_limits<double>::quiet_NaN();
+      }
+    }
+  } catch (const std::runtime_error& e) {
+    RCLCPP_ERROR_STREAM_THROTTLE(
+        get_logger(), *get_clock(), 1000, "[ScanComponent] - Invalid profile: " << e.what());
+    return;
+  }
+
+  if (nbPoints > 1 && lateral_.front() > lateral_.back()) {
+    std::reverse(lateral_.begin(), lateral_.end());
+    std::reverse(height_.begin(), height_.end());
+  }
+
+  const wp5_seam_tracking::Crest crest = detector_.detect(lateral_, height_);
+  if (!crest.valid) {
+    return;
+  }
+
+  // First order filter, the controller rate limits on top of it
+  const double gain = hasCorrection_ ? filterGain_ : 1.0;
+  lateralOffset_ += gain * (lateralSign_ * (crest.lateral - nominalLateral_) - lateralOffset_);
+  verticalOffset_ += gain * (crest.height - nominalHeight_ - verticalOffset_);
+  hasCorrection_ = true;
+
+  auto correction = std::make_unique<msg::PathCorrection>();
+  correction->header = msg->header;
+  correction->lateral = lateralOffset_;
+  correction->vertical = verticalOffset_;
+  correction->quality = crest.quality;
+  correctionPub_->publish(std::move(correction));
+}
+
+} // namespace wp5_pipeline
+
+RCLCPP_COMPONENTS_REGISTER_NODE(wp5_pipeline::ScanComponent)
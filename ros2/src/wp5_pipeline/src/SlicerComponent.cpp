@@ -0,0 +1,115 @@
+/**
+ * @file SlicerComponent.cpp
+ * @brief rclcpp component slicing the part and handing its layers to the replanner one at a time.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include "wp5_pipeline/SlicerComponent.h"
+
+#include <rclcpp_components/register_node_macro.hpp>
+
+#include <Eigen/Geometry>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+
+namespace wp5_pipeline {
+
+SlicerComponent::SlicerComponent(const rclcpp::NodeOptions& options) : Node("slicer", options) {
+  const std::vector<double> contour = declare_parameter<std::vector<double>>("contour", std::vector<double>());
+  if (contour.size() % 2 != 0) {
+    throw std::invalid_argument("[SlicerComponent] - Contour of an odd number of coordinates.");
+  }
+  std::vector<Eigen::Vector2d> vertices;
+  for (std::size_t i = 0; i + 1 < contour.size(); i += 2) {
+    vertices.emplace_back(contour[i], contour[i + 1]);
+  }
+
+  SlicerParameters params;
+  params.firstHeight = declare_parameter<double>("first_height", params.firstHeight);
+  params.layerHeight = declare_parameter<double>("layer_height", params.layerHeight);
+  params.nbLayers = static_cast<std::size_t>(
+      declare_parameter<std::int64_t>("nb_layers", static_cast<std::int64_t>(params.nbLayers)));
+  params.waypointSpacing = declare_parameter<double>("waypoint_spacing", params.waypointSpacing);
+  params.startShift = declare_parameter<double>("start_shift", params.startShift);
+  slicer_ = std::make_unique<LayerSlicer>(std::move(vertices), params);
+
+  frameId_ = declare_parameter<std::string>("frame_id", "part");
+  depositionSpeed_ = declare_parameter<double>("deposition_speed", depositionSpeed_);
+
+  // Default callback group, the service and the subscription never run concurrently
+  layerPub_ = create_publisher<msg::Layer>("layer", rclcpp::QoS(1).reliable());
+  layerDoneSub_ = create_subscription<std_msgs::msg::UInt32>(
+      "layer_done", rclcpp::QoS(8), [this](const std_msgs::msg::UInt32::SharedPtr msg) { layerDoneCallback_(msg); });
+  startService_ = create_service<std_srvs::srv::Trigger>(
+      "start_build",
+      [this](const std_srvs::srv::Trigger::Request::SharedPtr request,
+             std_srvs::srv::Trigger::Response::SharedPtr response) { startBuild_(request, response); });
+}
+
+void SlicerComponent::startBuild_(const std_srvs::srv::Trigger::Request::SharedPtr /*request*/,
+                                  std_srvs::srv::Trigger::Response::SharedPtr response) {
+  layers_.clear();
+  layers_.reserve(slicer_->getNbLayers());
+  for (std::size_t i = 0; i < slicer_->getNbLayers(); ++i) {
+    layers_.push_back(slicer_->slice(i));
+  }
+
+  if (layers_.empty()) {
+    response->success = false;
+    response->message = "No layer to build.";
+    return;
+  }
+
+  currentLayer_ = 0;
+  publishLayer_(currentLayer_);
+  response->success = true;
+  response->message = "Build of " + std::to_string(layers_.size()) + " layers started.";
+}
+
+void SlicerComponent::layerDoneCallback_(const std_msgs::msg::UInt32::SharedPtr msg) {
+  if (layers_.empty() || msg->data != currentLayer_) {
+    return;
+  }
+
+  if (++currentLayer_ >= layers_.size()) {
+    RCLCPP_INFO_STREAM(get_logger(), "[SlicerComponent] - Build of " << layers_.size() << " layers done.");
+    layers_.clear();
+    return;
+  }
+  publishLayer_(currentLayer_);
+}
+
+void SlicerComponent::publishLayer_(std::size_t index) {
+  // Torch pointing down, along the z axis of the part
+  const Eigen::Quaterniond orientation(Eigen::AngleAxisd(M_PI, Eigen::Vector3d::UnitX()));
+
+  auto layer = std::make_unique<msg::Layer>();
+  layer->header.stamp = now();
+  layer->header.frame_id = frameId_;
+  layer->index = static_cast<std::uint32_t>(index);
+  layer->height = slicer_->layerHeight(index);
+  layer->deposition_speed = depositionSpeed_;
+  layer->waypoints.resize(layers_[index].size());
+  for (std::size_t i = 0; i < layers_[index].size(); ++i) {
+    geometry_msgs::msg::Pose& pose = layer->waypoints[i];
+    pose.position.x = layers_[index][i].x();
+    pose.position.y = layers_[index][i].y();
+    pose.position.z = layers_[index][i].z();
+    pose.orientation.w = orientation.w();
+    pose.orientation.x = orientation.x();
+    pose.orientation.y = orientation.y();
+    pose.orientation.z = orientation.z();
+  }
+
+  RCLCPP_INFO_STREAM(get_logger(),
+                     "[SlicerComponent] - Layer " << index + 1 << "/" << layers_.size() << " of "
+                                                  << layer->waypoints.size() << " waypoints.");
+  layerPub_->publish(std::move(layer));
+}
+
+} // namespace wp5_pipeline
+
+RCLCPP_COMPONENTS_REGISTER_NODE(wp5_pipeline::SlicerComponent)
@@ -0,0 +1,90 @@
+/**
+ * @file test_layer_slicer.cpp
+ * @brief Unit tests of the slicing of a wall contour into layer paths.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <vector>
+
+#include "wp5_pipeline/LayerSlicer.h"
+
+namespace wp5_pipeline {
+
+namespace {
+
+// 10 cm by 5 cm rectangle, 30 cm around
+std::vector<Eigen::Vector2d> rectangle() { return {{0.0, 0.0}, {0.1, 0.0}, {0.1, 0.05}, {0.0, 0.05}}; }
+
+SlicerParameters parameters() {
+  SlicerParameters params;
+  params.firstHeight = 0.002;
+  params.layerHeight = 1.8e-3;
+  params.nbLayers = 5;
+  params.waypointSpacing = 1e-3;
+  params.startShift = 0.01;
+  return params;
+}
+
+bool contains(const std::vector<Eigen::Vector3d>& points, const Eigen::Vector2d& vertex) {
+  for (const Eigen::Vector3d& point : points) {
+    if ((point.head<2>() - vertex).norm() < 1e-12) {
+      return true;
+    }
+  }
+  return false;
+}
+
+} // namespace
+
+TEST(LayerSlicer, RejectsDegenerateContours) {
+  EXPECT_THROW(LayerSlicer({{0.0, 0.0}, {0.1, 0.0}}, parameters()), std::invalid_argument);
+  EXPECT_THROW(LayerSlicer({{0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}}, parameters()), std::invalid_argument);
+
+  SlicerParameters params = parameters();
+  params.waypointSpacing = 0.0;
+  EXPECT_THROW(LayerSlicer(rectangle(), params), std::invalid_argument);
+}
+
+TEST(LayerSlicer, ClosedLayerAtItsHeight) {
+  const LayerSlicer slicer(rectangle(), parameters());
+  for (std::size_t i = 0; i < slicer.getNbLayers(); ++i) {
+    const std::vector<Eigen::Vector3d> points = slicer.slice(i);
+    ASSERT_GT(points.size(), 2u);
+    EXPECT_TRUE(points.front().isApprox(points.back(), 1e-12)) << "layer " << i;
+
+    for (const Eigen::Vector3d& point : points) {
+      EXPECT_DOUBLE_EQ(point.z(), slicer.layerHeight(i));
+    }
+    for (std::size_t j = 0; j + 1 < points.size(); ++j) {
+      EXPECT_LE((points[j + 1] - points[j]).norm(), parameters().waypointSpacing + 1e-12);
+    }
+  }
+  EXPECT_DOUBLE_EQ(slicer.layerHeight(3), 0.002 + 3 * 1.8e-3);
+}
+
+TEST(LayerSlicer, KeepsEveryVertex) {
+  const LayerSlicer slicer(rectangle(), parameters());
+  for (std::size_t i = 0; i < slicer.getNbLayers(); ++i) {
+    const std::vector<Eigen::Vector3d> points = slicer.slice(i);
+    for (const Eigen::Vector2d& vertex : rectangle()) {
+      EXPECT_TRUE(contains(points, vertex)) << "layer " << i << " misses " << vertex.transpose();
+    }
+  }
+}
+
+TEST(LayerSlicer, ShiftsStartAlongContour) {
+  SlicerParameters params = parameters();
+  params.startShift = 0.12; // Past the first corner, wraps after two and a half layers
+  const LayerSlicer slicer(rectangle(), params);
+
+  EXPECT_TRUE(slicer.slice(0).front().head<2>().isApprox(Eigen::Vector2d(0.0, 0.0), 1e-12));
+  EXPECT_TRUE(slicer.slice(1).front().head<2>().isApprox(Eigen::Vector2d(0.1, 0.02), 1e-12));
+  EXPECT_TRUE(slicer.slice(3).front().head<2>().isApprox(Eigen::Vector2d(0.06, 0.0), 1e-12));
+}
+
+} // namespace wp5_pipeline
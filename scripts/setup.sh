@@ -8,7 +8,7 @@
 rosdep update
 cd ~/catkin_ws/src
 
-rosdep install -y --from-path ros-modbus-device-driver
+rosdep install -y --ignore-src --from-paths .
 
 cd ros-modbus-device-driver
 pip3 install -r requirements.txt
@@ -0,0 +1,42 @@
+/**
+ * @file LayerCycleBenchmark.h
+ * @brief Time of each stage of a layer cycle, from the scan of the part to the timed trajectory of the next layer.
+ *
+ * A reference part of square layers is built on the simulated heightmap and scanned by the simulated profiler along
+ * the next layer before any timing, so only the processing of the cell is measured. Each stage then runs on the same
+ * inputs, once to warm up and for the given number of repetitions. Shared by layer_cycle_benchmark, which prints the
+ * timings for run_benchmarks.py, and the regression test, which compares them to the stored baseline.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace wp5_benchmarks {
+
+struct StageTiming {
+  std::string name;
+  double median = 0.0;  // [ms]
+  double fastest = 0.0; // [ms]
+};
+
+struct LayerCycleTimings {
+  std::size_t nbWaypoints = 0;
+  std::size_t nbTcpSamples = 0;
+  double checksum = 0.0; // Accumulated results of the stages, so that none is optimized away
+  std::vector<StageTiming> stages;
+  double layerCycle = 0.0; // Sum of the stage medians [ms]
+};
+
+/**
+ * @brief Run every stage of the layer cycle on the cell of urdfPath, throws std::runtime_error if the cell cannot be
+ * read or the IK of the layer fails.
+ */
+LayerCycleTimings runLayerCycle(const std::string& urdfPath, std::size_t nbRepetitions);
+
+} // namespace wp5_benchmarks
@@ -0,0 +1,338 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+# Replay a recorded job to the nodes under test on a deterministic clock, check their outputs against the recorded
+# ones and measure the CPU and memory usage of each node.
+# Author: lmunier - <lmunier@protonmail.com>
+# Date: 2026-10-17
+#
+# The replayer owns /clock: the clock only depends on the bag, it is set to the record time of each input before the
+# input is published and advanced at clock_rate in between, while the rate only sets how fast the bag time runs on the
+# wall clock. Before each input, the replayer waits for the nodes to produce the outputs recorded before it, so an
+# accelerated replay never outruns a node and drops its inputs. Outputs are matched to the recorded ones on their header
+# stamp, so a dropped or late output shows up as missing. The report is written as YAML, and compared to a previous
+# report given as baseline.
+
+import bisect
+import math
+import os
+import sys
+import threading
+import time
+from xmlrpc.client import ServerProxy
+
+import genpy
+import rosbag
+import rosgraph
+import rosnode
+import rospy
+import yaml
+from roslib.message import get_message_class
+from rosgraph_msgs.msg import Clock
+
+
+def difference(a, b):
+    """Largest difference between the fields of two messages, the headers apart, infinite when they do not compare."""
+    if isinstance(a, genpy.TVal):
+        return abs(a.to_sec() - b.to_sec())
+    if hasattr(a, "__slots__"):
+        return max([difference(getattr(a, slot), getattr(b, slot)) for slot in a.__slots__ if slot != "header"],
+                   default=0.0)
+    if isinstance(a, (list, tuple)):
+        if len(a) != len(b):
+            return math.inf
+        return max([difference(x, y) for x, y in zip(a, b)], default=0.0)
+    if isinstance(a, float) or isinstance(b, float):
+        if math.isnan(a) or math.isnan(b):
+            return 0.0 if math.isnan(a) and math.isnan(b) else math.inf
+        return abs(a - b)
+    if isinstance(a, int) and isinstance(b, int):
+        return float(abs(a - b))
+    return 0.0 if a == b else math.inf
+
+
+class ProcessUsage:
+    """CPU time and peak resident memory of a process, read from /proc."""
+
+    def __init__(self, pid):
+        self.pid = pid
+        self.start_cpu = self.read_cpu()
+        self.peak_rss = self.read_rss()
+
+    def read_cpu(self):
+        with open("/proc/{}/stat".format(self.pid)) as stat:
+            fields = stat.read().rsplit(")", 1)[1].split()
+        return (int(fields[11]) + int(fields[12])) / os.sysconf("SC_CLK_TCK")
+
+    def read_rss(self):
+        with open("/proc/{}/status".format(self.pid)) as status:
+            for line in status:
+                if line.startswith("VmRSS:"):
+                    return int(line.split()[1]) * 1024
+        return 0
+
+    def sample(self):
+        self.peak_rss = max(self.peak_rss, self.read_rss())
+
+
+class JobReplayer:
+    def __init__(self):
+        self.bag_path = rospy.get_param("~bag")
+        self.rate = rospy.get_param("~rate", 1.0)
+        self.inputs = [rospy.resolve_name(topic) for topic in rospy.get_param("~inputs", [])]
+        self.outputs = {rospy.resolve_name(topic): config for topic, config in rospy.get_param("~outputs", {}).items()}
+        self.stamp_tolerance = rospy.get_param("~stamp_tolerance", 1e-6)
+        self.max_missing = rospy.get_param("~max_missing", 0.0)
+        self.clock_period = rospy.Duration(1.0 / rospy.get_param("~clock_rate", 1000.0))
+        self.settle_time = rospy.Duration(rospy.get_param("~settle_time", 1.0))
+        self.wait_subscribers = rospy.get_param("~wait_subscribers", 10.0)
+        self.output_timeout = rospy.get_param("~output_timeout", 1.0)
+        self.node_names = [rospy.resolve_name(node) for node in rospy.get_param("~nodes", [])]
+        self.sample_period = rospy.get_param("~sample_period", 0.1)
+        self.cpu_tolerance = rospy.get_param("~cpu_tolerance", 0.2)
+        self.report_path = rospy.get_param("~report", "")
+        self.baseline_path = rospy.get_param("~baseline", "")
+
+        self.bag = rosbag.Bag(self.bag_path)
+        topics = self.bag.get_type_and_topic_info().topics
+        missing_inputs = [topic for topic in self.inputs if topic not in topics]
+        if missing_inputs:
+            rospy.logwarn("[replay_job] - Inputs not recorded: %s.", ", ".join(missing_inputs))
+
+        self.clock_pub = rospy.Publisher("/clock", Clock, queue_size=16)
+        self.publishers = {}
+        for topic in self.inputs:
+            if topic in topics:
+                message_class = get_message_class(topics[topic].msg_type)
+                self.publishers[topic] = rospy.Publisher(topic, message_class, queue_size=1000)
+
+        # Record time of each recorded output, the replay waits for them before publishing later inputs
+        self.recorded_times = {topic: [] for topic in self.outputs if topic in topics}
+        for topic, _, stamp in self.bag.read_messages(topics=list(self.recorded_times)):
+            self.recorded_times[topic].append(stamp)
+        self.given_up = {topic: 0 for topic in self.recorded_times}
+
+        self.lock = threading.Lock()
+        self.output_received = threading.Condition(self.lock)
+        self.replayed = {topic: [] for topic in self.outputs}
+        self.subscribers = []
+        for topic in self.outputs:
+            if topic not in topics:
+                rospy.logwarn("[replay_job] - Output %s not recorded, only counted.", topic)
+                message_class = rospy.AnyMsg
+            else:
+                message_class = get_message_class(topics[topic].msg_type)
+            self.subscribers.append(
+                rospy.Subscriber(topic, message_class, self.output_callback, topic, queue_size=10000, tcp_nodelay=True))
+
+    def output_callback(self, msg, topic):
+        with self.output_received:
+            self.replayed[topic].append(msg)
+            self.output_received.notify_all()
+
+    def find_processes(self):
+        master = rosgraph.Master(rospy.get_name())
+        processes = {}
+        for name in self.node_names:
+            uri = rosnode.get_api_uri(master, name, skip_cache=True)
+            if not uri:
+                rospy.logwarn("[replay_job] - Node %s not running, not measured.", name)
+                continue
+            code, _, pid = ServerProxy(uri).getPid(rospy.get_name())
+            if code == 1:
+                processes[name] = ProcessUsage(pid)
+        return processes
+
+    def wait_for_subscribers(self):
+        deadline = time.monotonic() + self.wait_subscribers
+        while time.monotonic() < deadline and not rospy.is_shutdown():
+            if all(publisher.get_num_connections() > 0 for publisher in self.publishers.values()):
+                return
+            time.sleep(0.1)
+        idle = [topic for topic, publisher in self.publishers.items() if publisher.get_num_connections() == 0]
+        rospy.logwarn("[replay_job] - No subscriber on %s.", ", ".join(idle))
+
+    def wait_outputs(self, stamp):
+        """Wait until the nodes produced every output recorded before stamp, at most output_timeout of wall time.
+
+        Outputs still missing at the timeout are given up, the replay goes on without waiting for them again, and they
+        are counted as missing by the comparison.
+        """
+        deadline = time.monotonic() + self.output_timeout
+        with self.output_received:
+            while not rospy.is_shutdown():
+                lagging = {}
+                for topic, times in self.recorded_times.items():
+                    shortfall = bisect.bisect_left(times, stamp) - len(self.replayed[topic]) - self.given_up[topic]
+                    if shortfall > 0:
+                        lagging[topic] = shortfall
+                if not lagging:
+                    return
+
+                remaining = deadline - time.monotonic()
+                if remaining <= 0.0:
+                    for topic, shortfall in lagging.items():
+                        self.given_up[topic] += shortfall
+                    rospy.logwarn("[replay_job] - No output on %s after %.1f s, replay continued.",
+                                  ", ".join(lagging), self.output_timeout)
+                    return
+                self.output_received.wait(remaining)
+
+    def play(self, stop_sampling):
+        """Publish the inputs on the replay clock, paced on the wall clock at rate times real time.
+
+        The pace is an upper bound: each input waits for the outputs recorded before it, so the bag time runs slower
+        than rate whenever a node lags behind.
+        """
+        start = None
+        wall_start = 0.0
+        clock = None
+
+        def advance(target):
+            nonlocal clock
+            while clock < target and not rospy.is_shutdown():
+                clock = min(clock + self.clock_period, target)
+                if self.rate > 0.0:
+                    delay = wall_start + (clock - start).to_sec() / self.rate - time.monotonic()
+                    if delay > 0.0:
+                        time.sleep(delay)
+                self.clock_pub.publish(Clock(clock=clock))
+
+        for topic, msg, stamp in self.bag.read_messages(topics=list(self.publishers)):
+            if rospy.is_shutdown():
+                break
+            if start is None:
+                start = clock = stamp
+                wall_start = time.monotonic()
+                self.clock_pub.publish(Clock(clock=clock))
+            advance(stamp)
+            self.wait_outputs(stamp)
+            self.publishers[topic].publish(msg)
+
+        if start is not None:
+            advance(clock + self.settle_time)
+            self.wait_outputs(clock + rospy.Duration(1e-9))
+        stop_sampling.set()
+        return (clock - start).to_sec() if start is not None else 0.0
+
+    def compare_outputs(self):
+        results = {}
+        recorded = {topic: [] for topic in self.outputs}
+        for topic, msg, _ in self.bag.read_messages(topics=list(self.outputs)):
+            recorded[topic].append(msg)
+
+        for topic, config in self.outputs.items():
+            with self.lock:
+                replayed = list(self.replayed[topic])
+            result = {"recorded": len(recorded[topic]), "replayed": len(replayed)}
+            if not recorded[topic] or not hasattr(recorded[topic][0], "header"):
+                results[topic] = result
+                continue
+
+            tolerance = config.get("tolerance", 0.0)
+            stamp_tolerance = config.get("stamp_tolerance", self.stamp_tolerance)
+            by_stamp = sorted(replayed, key=lambda msg: msg.header.stamp)
+            stamps = [msg.header.stamp.to_sec() for msg in by_stamp]
+
+            matched = 0
+            max_error = 0.0
+            index = 0
+            for msg in sorted(recorded[topic], key=lambda msg: msg.header.stamp):
+                stamp = msg.header.stamp.to_sec()
+                while index < len(stamps) and stamps[index] < stamp - stamp_tolerance:
+                    index += 1
+                if index < len(stamps) and stamps[index] <= stamp + stamp_tolerance:
+                    error = difference(msg, by_stamp[index])
+                    max_error = max(max_error, error)
+                    matched += error <= tolerance
+                    index += 1
+
+            missing = 1.0 - matched / len(recorded[topic]) if recorded[topic] else 0.0
+            result.update(matched=matched, max_error=float(max_error), passed=missing <= self.max_missing)
+            results[topic] = result
+        return results
+
+    def run(self):
+        processes = self.find_processes()
+        self.wait_for_subscribers()
+
+        stop_sampling = threading.Event()
+
+        def sample():
+            while not stop_sampling.wait(self.sample_period):
+                for usage in processes.values():
+                    usage.sample()
+
+        sampler = threading.Thread(target=sample)
+        sampler.start()
+        wall_start = time.monotonic()
+        bag_duration = self.play(stop_sampling)
+        wall_duration = time.monotonic() - wall_start
+        sampler.join()
+
+        report = {
+            "bag": os.path.abspath(self.bag_path),
+            "bag_duration": bag_duration,
+            "wall_duration": wall_duration,
+            "outputs": self.compare_outputs(),
+            "nodes": {},
+        }
+        for name, usage in processes.items():
+            cpu_time = usage.read_cpu() - usage.start_cpu
+            report["nodes"][name] = {
+                "pid": usage.pid,
+                "cpu_time": cpu_time,
+                "cpu_load": cpu_time / wall_duration if wall_duration > 0.0 else 0.0,
+                "peak_rss": usage.peak_rss,
+            }
+
+        regressions = self.compare_baseline(report)
+        report["passed"] = not regressions and all(output.get("passed", True) for output in report["outputs"].values())
+        self.log_report(report, regressions)
+
+        if self.report_path:
+            with open(self.report_path, "w") as report_file:
+                yaml.safe_dump(report, report_file, default_flow_style=False, sort_keys=False)
+            rospy.loginfo("[replay_job] - Report written to %s.", self.report_path)
+        return report["passed"]
+
+    def compare_baseline(self, report):
+        if not self.baseline_path:
+            return []
+        with open(self.baseline_path) as baseline_file:
+            baseline = yaml.safe_load(baseline_file) or {}
+
+        # CPU time is compared rather than load, it does not depend on the replay rate
+        regressions = []
+        for name, usage in report["nodes"].items():
+            reference = baseline.get("nodes", {}).get(name)
+            if reference and usage["cpu_time"] > (1.0 + self.cpu_tolerance) * reference["cpu_time"]:
+                regressions.append(name)
+        return regressions
+
+    def log_report(self, report, regressions):
+        rospy.loginfo(
+            "[replay_job] - %.1f s of job replayed in %.1f s.", report["bag_duration"], report["wall_duration"])
+        for topic, output in report["outputs"].items():
+            log = rospy.loginfo if output.get("passed", True) else rospy.logerr
+            log("[replay_job] - %s: %d recorded, %d replayed, %s matched, max error %g.", topic, output["recorded"],
+                output["replayed"], output.get("matched", "-"), output.get("max_error", 0.0))
+        for name, usage in report["nodes"].items():
+            log = rospy.logerr if name in regressions else rospy.loginfo
+            log("[replay_job] - %s: %.2f s CPU, %.0f %% load, %.1f MB peak.", name, usage["cpu_time"],
+                100.0 * usage["cpu_load"], usage["peak_rss"] / 1e6)
+        if report["passed"]:
+            rospy.loginfo("[replay_job] - Replay passed.")
+        else:
+            rospy.logerr("[replay_job] - Replay failed.")
+
+
+def main():
+    rospy.init_node("replay_job")
+    passed = JobReplayer().run()
+    rospy.signal_shutdown("Replay done" if passed else "Replay failed")
+    sys.exit(0 if passed else 1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+# Run the layer cycle benchmark and compare the time of each stage to the stored baseline.
+# Author: lmunier - <lmunier@protonmail.com>
+# Date: 2026-10-17
+#
+# A stage whose median is slower than the baseline by more than the tolerance of the baseline is a regression, and the
+# script then exits with an error. The baseline holds the timings of the reference machine, it is rewritten with
+# --update after a deliberate change of the timings. With --jitter-executable, the wake-up jitter of a control loop
+# under load is reported too, with and without the thread placement of RT_CPUS. It depends on the machine it runs on
+# rather than on the code, so it is compared between both placements only.
+
+import argparse
+import os
+import subprocess
+import sys
+
+import yaml
+
+
+def share_path(*parts):
+    return os.path.join(os.path.dirname(os.path.dirname(os.path.realpath(__file__))), *parts)
+
+
+def run_benchmark(executable, urdf, repetitions):
+    output = subprocess.run(
+        [executable, urdf, str(repetitions)], check=True, stdout=subprocess.PIPE, universal_newlines=True
+    ).stdout
+    return yaml.safe_load(output)
+
+
+def run_jitter(executable, duration):
+    output = subprocess.run(
+        [executable, str(duration)], check=True, stdout=subprocess.PIPE, universal_newlines=True
+    ).stdout
+    return yaml.safe_load(output)
+
+
+def report_jitter(jitter):
+    configurations = jitter["configurations"]
+    print("{:<20} {:>12} {:>12} {:>12}".format("jitter [us]", "p50", "p99", "max"))
+    for name, lateness in configurations.items():
+        print("{:<20} {:>12.1f} {:>12.1f} {:>12.1f}".format(name, lateness["p50"], lateness["p99"], lateness["max"]))
+
+    shared, placed = configurations["shared"], configurations["placed"]
+    if not placed["applied"]:
+        print("[run_benchmarks] - Placement refused, run with the SYS_NICE capability to measure it.")
+    elif shared["p99"] > 0.0 and shared["max"] > 0.0:
+        print("[run_benchmarks] - Placement on cores {}: p99 jitter {:+.0f} %, worst {:+.0f} %.".format(
+            jitter["reserved_cpus"] or "not reserved", 100.0 * (placed["p99"] / shared["p99"] - 1.0),
+            100.0 * (placed["max"] / shared["max"] - 1.0)))
+
+
+def compare(results, baseline):
+    tolerance = baseline.get("tolerance", 0.2)
+    reference = baseline.get("stages") or {}
+    regressions = []
+
+    print("{:<20} {:>12} {:>12} {:>9}".format("stage [ms]", "median", "baseline", "change"))
+    for name, timing in results["stages"].items():
+        median = timing["median"]
+        if name not in reference:
+            print("{:<20} {:>12.3f} {:>12} {:>9}".format(name, median, "-", "-"))
+            continue
+
+        expected = reference[name]["median"]
+        change = median / expected - 1.0 if expected > 0.0 else 0.0
+        print("{:<20} {:>12.3f} {:>12.3f} {:>+8.1f}%".format(name, median, expected, 100.0 * change))
+        if change > tolerance:
+            regressions.append(name)
+
+    print("{:<20} {:>12.3f} {:>12.3f}".format("layer_cycle", results["layer_cycle"], baseline.get("layer_cycle", 0.0)))
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Run the layer cycle benchmark against the stored baseline.")
+    parser.add_argument("--executable", default="layer_cycle_benchmark", help="Benchmark executable")
+    parser.add_argument("--urdf", default=share_path("urdf", "benchmark_cell.urdf"), help="Cell of the benchmark")
+    parser.add_argument("--baseline", default=share_path("config", "baseline.yaml"), help="Stored baseline")
+    parser.add_argument("-n", "--repetitions", type=int, help="Repetitions of each stage, from the baseline by default")
+    parser.add_argument("--update", action="store_true", help="Store the timings of this run as the new baseline")
+    parser.add_argument("--jitter-executable", help="Jitter benchmark executable, the jitter is not measured without")
+    parser.add_argument("--jitter-duration", type=float, default=10.0, help="Duration of each jitter run [s]")
+    args = parser.parse_args()
+
+    with open(args.baseline) as baseline_file:
+        baseline = yaml.safe_load(baseline_file) or {}
+
+    repetitions = args.repetitions or baseline.get("repetitions", 20)
+    try:
+        results = run_benchmark(args.executable, args.urdf, repetitions)
+    except (OSError, subprocess.CalledProcessError) as error:
+        print("[run_benchmarks] - Benchmark failed: {}".format(error), file=sys.stderr)
+        return 1
+
+    if args.update:
+        baseline["repetitions"] = repetitions
+        baseline.setdefault("tolerance", 0.2)
+        baseline["stages"] = {name: {"median": timing["median"]} for name, timing in results["stages"].items()}
+        baseline["layer_cycle"] = results["layer_cycle"]
+        with open(args.baseline, "w") as baseline_file:
+            baseline_file.write("# Median time of each stage on the reference machine [ms], recorded with "
+                                "run_benchmarks.py --update\n")
+            yaml.safe_dump(baseline, baseline_file, default_flow_style=False, sort_keys=False)
+        print("[run_benchmarks] - Baseline updated in {}.".format(args.baseline))
+        return 0
+
+    if not baseline.get("stages"):
+        print("[run_benchmarks] - No baseline stored yet, record one on the reference machine with --update.")
+
+    regressions = compare(results, baseline)
+
+    if args.jitter_executable:
+        try:
+            report_jitter(run_jitter(args.jitter_executable, args.jitter_duration))
+        except (OSError, subprocess.CalledProcessError) as error:
+            print("[run_benchmarks] - Jitter benchmark failed: {}".format(error), file=sys.stderr)
+            return 1
+
+    if regressions:
+        print("[run_benchmarks] - Regression of {} beyond {:.0f} %.".format(
+            ", ".join(regressions), 100.0 * baseline.get("tolerance", 0.2)), file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,223 @@
+/**
+ * @file LayerCycleBenchmark.cpp
+ * @brief Time of each stage of a layer cycle, from the scan of the part to the timed trajectory of the next layer.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include "wp5_benchmarks/LayerCycleBenchmark.h"
+
+#include <Eigen/Geometry>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "wp5_monitoring/PlannedPath.h"
+#include "wp5_planner/CoordinatedIkSolver.h"
+#include "wp5_planner/TrajectoryParameterizer.h"
+#include "wp5_seam_tracking/CrestDetector.h"
+#include "wp5_simulation/Heightmap.h"
+#include "wp5_simulation/HeightmapRaycaster.h"
+
+namespace wp5_benchmarks {
+
+namespace {
+
+struct BenchmarkParameters {
+  double side = 0.12;            // Side of the square layers [m]
+  double waypointSpacing = 1e-3; // [m]
+  std::size_t nbLayers = 5;      // Layers of the reference part below the benchmarked one
+  double layerHeight = 1.8e-3;   // [m]
+  double depositionSpeed = 0.01; // [m/s]
+  double sensorHeight = 0.1;     // Height of the profiler above the layer [m]
+  std::size_t nbProfilePoints = 640;
+  double tcpRate = 500.0; // Rate of the measured TCP positions [Hz]
+};
+
+template <typename Stage>
+StageTiming timeStage(const std::string& name, std::size_t nbRepetitions, Stage&& stage) {
+  stage();
+
+  std::vector<double> times;
+  times.reserve(nbRepetitions);
+  for (std::size_t i = 0; i < nbRepetitions; ++i) {
+    const auto start = std::chrono::steady_clock::now();
+    stage();
+    times.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+  }
+
+  std::sort(times.begin(), times.end());
+  return StageTiming{name, times[times.size() / 2], times.front()};
+}
+
+// Closed square around the origin of the part frame, counterclockwise from the middle of a side, away from the corners
+std::vector<Eigen::Vector3d> squareLayer(const BenchmarkParameters& params, double z) {
+  const double half = 0.5 * params.side;
+  const Eigen::Vector3d corners[6] = {
+      {0.0, -half, z}, {half, -half, z}, {half, half, z}, {-half, half, z}, {-half, -half, z}, {0.0, -half, z}};
+
+  std::vector<Eigen::Vector3d> points;
+  for (int side = 0; side < 5; ++side) {
+    const double length = (corners[side + 1] - corners[side]).norm();
+    const std::size_t nbSteps = static_cast<std::size_t>(std::ceil(length / params.waypointSpacing));
+    for (std::size_t i = 0; i < nbSteps; ++i) {
+      points.push_back(corners[side] + (corners[side + 1] - corners[side]) * (static_cast<double>(i) / nbSteps));
+    }
+  }
+  points.push_back(corners[5]);
+  return points;
+}
+
+std::string readFile(const std::string& path) {
+  std::ifstream file(path);
+  if (!file) {
+    throw std::runtime_error("[LayerCycleBenchmark] - Cannot read " + path + ".");
+  }
+  std::ostringstream content;
+  content << file.rdbuf();
+  return content.str();
+}
+
+} // namespace
+
+LayerCycleTimings runLayerCycle(const std::string& urdfPath, std::size_t nbRepetitions) {
+  const BenchmarkParameters params;
+
+  // Reference part, the benchmarked layer goes on top of it
+  wp5_simulation::HeightmapParameters heightmapParams;
+  heightmapParams.size = Eigen::Vector2d::Constant(params.side + 0.05);
+  heightmapParams.origin = -0.5 * heightmapParams.size;
+  wp5_simulation::Heightmap heightmap(heightmapParams);
+
+  wp5_simulation::BeadGeometry bead;
+  bead.height = params.layerHeight;
+  for (std::size_t layer = 0; layer < params.nbLayers; ++layer) {
+    const std::vector<Eigen::Vector3d> points = squareLayer(params, 0.0);
+    heightmap.startBead();
+    for (std::size_t i = 1; i < points.size(); ++i) {
+      heightmap.depositSegment(points[i - 1].head<2>(), points[i].head<2>(), bead);
+    }
+  }
+
+  const std::vector<Eigen::Vector3d> layer = squareLayer(params, params.nbLayers * params.layerHeight);
+  const std::size_t nbWaypoints = layer.size();
+
+  // Torch pointing down, as the deposition direction of the planner
+  std::vector<Eigen::Isometry3d> waypoints(nbWaypoints, Eigen::Isometry3d::Identity());
+  for (std::size_t i = 0; i < nbWaypoints; ++i) {
+    waypoints[i].translation() = layer[i];
+    waypoints[i].linear() = Eigen::AngleAxisd(M_PI, Eigen::Vector3d::UnitX()).toRotationMatrix();
+  }
+
+  // One profile per waypoint, the laser fan across the path
+  Eigen::Matrix3Xd directions(3, params.nbProfilePoints);
+  for (std::size_t i = 0; i < params.nbProfilePoints; ++i) {
+    const double angle = 0.5 * (static_cast<double>(i) / (params.nbProfilePoints - 1) - 0.5);
+    directions.col(i) << std::sin(angle), 0.0, std::cos(angle);
+  }
+
+  wp5_simulation::HeightmapRaycaster raycaster;
+  std::vector<std::vector<double>> profileLateral(nbWaypoints), profileHeight(nbWaypoints);
+  Eigen::ArrayXd ranges;
+  for (std::size_t i = 0; i < nbWaypoints; ++i) {
+    const Eigen::Vector3d tangent = (layer[std::min(i + 1, nbWaypoints - 1)] - layer[i > 0 ? i - 1 : 0]).normalized();
+    const Eigen::Vector3d lateral = Eigen::Vector3d::UnitZ().cross(tangent);
+
+    Eigen::Isometry3d sensor = Eigen::Isometry3d::Identity();
+    sensor.linear().col(0) = lateral;
+    sensor.linear().col(2) = -Eigen::Vector3d::UnitZ();
+    sensor.linear().col(1) = sensor.linear().col(2).cross(lateral);
+    sensor.translation() = layer[i] + params.sensorHeight * Eigen::Vector3d::UnitZ();
+    raycaster.castFan(heightmap, sensor, directions, 0.0, 2.0 * params.sensorHeight, ranges);
+
+    profileLateral[i].resize(params.nbProfilePoints);
+    profileHeight[i].resize(params.nbProfilePoints);
+    for (std::size_t j = 0; j < params.nbProfilePoints; ++j) {
+      profileLateral[i][j] = ranges[j] * directions(0, j);
+      profileHeight[i][j] = -ranges[j] * directions(2, j);
+    }
+  }
+
+  // TCP measured along the layer, slightly off the planned path
+  std::vector<double> times(nbWaypoints);
+  for (std::size_t i = 1; i < nbWaypoints; ++i) {
+    times[i] = times[i - 1] + (layer[i] - layer[i - 1]).norm() / params.depositionSpeed;
+  }
+  std::vector<Eigen::Vector3d> measured;
+  for (double t = 0.0; t < times.back(); t += 1.0 / params.tcpRate) {
+    const std::size_t i = std::upper_bound(times.begin(), times.end(), t) - times.begin() - 1;
+    const double ratio = (t - times[i]) / (times[i + 1] - times[i]);
+    measured.push_back(layer[i] + ratio * (layer[i + 1] - layer[i]) + Eigen::Vector3d(0.0, 0.0, 2e-4 * std::sin(t)));
+  }
+
+  wp5_planner::CoordinatedIkParameters ikParams;
+  wp5_planner::CoordinatedIkSolver solver(readFile(urdfPath), "world", "positioner_table", "tool0", ikParams);
+
+  // Elbow up above the positioner, joints missing from the seed start at zero
+  const std::vector<std::pair<std::string, double>> seedJoints = {{"shoulder_lift_joint", -1.2},
+                                                                   {"elbow_joint", 1.6},
+                                                                   {"wrist_1_joint", -1.97},
+                                                                   {"wrist_2_joint", -1.57}};
+  Eigen::VectorXd seed = Eigen::VectorXd::Zero(solver.getNbJoints());
+  for (const auto& [name, value] : seedJoints) {
+    const auto it = std::find(solver.getJointNames().begin(), solver.getJointNames().end(), name);
+    if (it != solver.getJointNames().end()) {
+      seed[std::distance(solver.getJointNames().begin(), it)] = value;
+    }
+  }
+
+  std::vector<wp5_planner::IkResult> ikResults = solver.solveBatch(waypoints, seed);
+  std::vector<Eigen::VectorXd> joints;
+  for (std::size_t i = 0; i < ikResults.size(); ++i) {
+    if (!ikResults[i].success) {
+      throw std::runtime_error("[LayerCycleBenchmark] - IK failed at waypoint " + std::to_string(i) + ".");
+    }
+    joints.push_back(ikResults[i].joints);
+  }
+
+  LayerCycleTimings timings;
+  timings.nbWaypoints = nbWaypoints;
+  timings.nbTcpSamples = measured.size();
+  double& checksum = timings.checksum;
+
+  timings.stages.push_back(timeStage("seam_tracking", nbRepetitions, [&]() {
+    wp5_seam_tracking::CrestDetector detector;
+    for (std::size_t i = 0; i < nbWaypoints; ++i) {
+      checksum += detector.detect(profileLateral[i], profileHeight[i]).lateral;
+    }
+  }));
+
+  timings.stages.push_back(timeStage("deviation", nbRepetitions, [&]() {
+    const wp5_monitoring::PlannedPath path(layer, times);
+    std::size_t hint = 0;
+    for (const Eigen::Vector3d& position : measured) {
+      const wp5_monitoring::PlannedPath::Projection projection = path.project(position, hint);
+      hint = projection.segment;
+      checksum += (position - projection.closest).norm();
+    }
+  }));
+
+  timings.stages.push_back(timeStage("ik", nbRepetitions, [&]() {
+    ikResults = solver.solveBatch(waypoints, seed);
+    checksum += ikResults.back().positionError;
+  }));
+
+  timings.stages.push_back(timeStage("parameterization", nbRepetitions, [&]() {
+    const trajectory_msgs::JointTrajectory trajectory = wp5_planner::parameterizeTrajectory(
+        waypoints, joints, solver.getJointNames(), solver.getVelocityLimits(), params.depositionSpeed, 0.8);
+    checksum += trajectory.points.back().time_from_start.toSec();
+  }));
+
+  for (const StageTiming& timing : timings.stages) {
+    timings.layerCycle += timing.median;
+  }
+  return timings;
+}
+
+} // namespace wp5_benchmarks
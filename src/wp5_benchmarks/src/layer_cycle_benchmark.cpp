@@ -0,0 +1,44 @@
+/**
+ * @file layer_cycle_benchmark.cpp
+ * @brief Time of each stage of a layer cycle, printed as YAML for run_benchmarks.py.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include <ros/ros.h>
+
+#include <algorithm>
+#include <exception>
+#include <iostream>
+#include <string>
+
+#include "wp5_benchmarks/LayerCycleBenchmark.h"
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    std::cerr << "Usage: layer_cycle_benchmark <cell.urdf> [repetitions]" << std::endl;
+    return 2;
+  }
+
+  // Messages are stamped, no ROS master is needed
+  ros::Time::init();
+
+  try {
+    const std::size_t nbRepetitions = argc > 2 ? std::max(1, std::stoi(argv[2])) : 20;
+    const wp5_benchmarks::LayerCycleTimings timings = wp5_benchmarks::runLayerCycle(argv[1], nbRepetitions);
+
+    std::cout << "# Layer of " << timings.nbWaypoints << " waypoints, " << timings.nbTcpSamples
+              << " TCP samples, checksum " << timings.checksum << "\n";
+    std::cout << "repetitions: " << nbRepetitions << "\n";
+    std::cout << "stages: # [ms]\n";
+    for (const wp5_benchmarks::StageTiming& timing : timings.stages) {
+      std::cout << "  " << timing.name << ": {median: " << timing.median << ", fastest: " << timing.fastest << "}\n";
+    }
+    std::cout << "layer_cycle: " << timings.layerCycle << " # Sum of the stage medians [ms]\n";
+    return 0;
+  } catch (const std::exception& e) {
+    std::cerr << e.what() << std::endl;
+    return 1;
+  }
+}
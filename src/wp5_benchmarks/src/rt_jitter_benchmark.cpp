@@ -0,0 +1,166 @@
+/**
+ * @file rt_jitter_benchmark.cpp
+ * @brief Wake-up jitter of a periodic control loop while the task scheduler runs heavy parallel loops.
+ *
+ * The control loop sleeps until each period on the monotonic clock and measures how late it wakes up, while a task
+ * scheduler with a thread per core streams through buffers larger than the caches, as the geometry jobs of the cell.
+ * It runs twice: shared, every thread on every core with the default policy, then placed, the loop pinned to the cores
+ * reserved by RT_CPUS with a SCHED_FIFO priority and the scheduler confined to the other cores. The percentiles of the
+ * lateness of both are printed as YAML, compared by run_benchmarks.py.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include <pthread.h>
+#include <time.h>
+#include <wp5_common/TaskScheduler.h>
+#include <wp5_common/ThreadPlacement.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace wp5_benchmarks {
+
+namespace {
+
+struct JitterParameters {
+  double duration = 10.0;         // Of each configuration [s]
+  double rate = 500.0;            // Of the control loop [Hz]
+  int priority = 80;              // SCHED_FIFO priority of the placed loop
+  std::size_t loadSize = 1 << 21; // Doubles streamed by each load thread, beyond the caches
+};
+
+struct JitterResult {
+  std::string name;
+  double p50 = 0.0; // [us]
+  double p99 = 0.0; // [us]
+  double max = 0.0; // [us]
+  bool applied = true;
+};
+
+std::int64_t toNanoseconds(const timespec& time) {
+  return static_cast<std::int64_t>(time.tv_sec) * 1000000000 + time.tv_nsec;
+}
+
+timespec toTimespec(std::int64_t nanoseconds) {
+  return timespec{static_cast<time_t>(nanoseconds / 1000000000), static_cast<long>(nanoseconds % 1000000000)};
+}
+
+JitterResult measure(const std::string& name,
+                     const JitterParameters& params,
+                     std::size_t nbThreads,
+                     const wp5_common::ThreadPlacement& loopPlacement,
+                     const std::vector<int>& loadCpus) {
+  wp5_common::TaskScheduler scheduler(nbThreads, loadCpus);
+  std::atomic<bool> stop{false};
+
+  std::thread load([&]() {
+    if (!loadCpus.empty()) {
+      wp5_common::applyPlacement(pthread_self(), wp5_common::ThreadPlacement{loadCpus, 0}, "Load");
+    }
+    std::vector<std::vector<double>> buffers(nbThreads, std::vector<double>(params.loadSize, 1.0));
+    while (!stop) {
+      scheduler.parallelFor(0, nbThreads, [&](std::size_t i) {
+        for (double& value : buffers[i]) {
+          value = 0.5 * value + 1.0;
+        }
+      });
+    }
+  });
+
+  JitterResult result;
+  result.name = name;
+  const std::size_t nbCycles = static_cast<std::size_t>(params.duration * params.rate);
+  const std::int64_t period = static_cast<std::int64_t>(1e9 / params.rate);
+  std::vector<double> lateness;
+  lateness.reserve(nbCycles);
+
+  std::thread loop([&]() {
+    result.applied = wp5_common::applyPlacement(pthread_self(), loopPlacement, "Control loop");
+
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    std::int64_t wakeUp = toNanoseconds(now);
+    for (std::size_t i = 0; i < nbCycles; ++i) {
+      wakeUp += period;
+      const timespec target = toTimespec(wakeUp);
+      while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &target, nullptr) == EINTR) {
+      }
+      clock_gettime(CLOCK_MONOTONIC, &now);
+      lateness.push_back(1e-3 * static_cast<double>(toNanoseconds(now) - wakeUp));
+    }
+  });
+  loop.join();
+
+  stop = true;
+  load.join();
+
+  std::sort(lateness.begin(), lateness.end());
+  result.p50 = lateness[lateness.size() / 2];
+  result.p99 = lateness[std::min(lateness.size() - 1, lateness.size() * 99 / 100)];
+  result.max = lateness.back();
+  return result;
+}
+
+std::string toString(const std::vector<int>& cpus) {
+  std::string list;
+  for (const int cpu : cpus) {
+    list += (list.empty() ? "" : ",") + std::to_string(cpu);
+  }
+  return list;
+}
+
+} // namespace
+
+int run(const JitterParameters& params) {
+  // As many load threads as cores in both configurations, so only the placement differs
+  const std::size_t nbThreads = std::max(1u, std::thread::hardware_concurrency());
+  const std::vector<int> reserved = wp5_common::reservedCpus();
+  const std::vector<int> workers = wp5_common::workerCpus();
+
+  std::vector<JitterResult> results;
+  results.push_back(measure("shared", params, nbThreads, wp5_common::ThreadPlacement{}, {}));
+  results.push_back(
+      measure("placed", params, nbThreads, wp5_common::ThreadPlacement{reserved, params.priority}, workers));
+
+  std::cout << "# " << static_cast<std::size_t>(params.duration * params.rate) << " cycles per configuration under "
+            << nbThreads << " load threads\n";
+  std::cout << "rate: " << params.rate << " # [Hz]\n";
+  std::cout << "priority: " << params.priority << "\n";
+  std::cout << "reserved_cpus: \"" << toString(reserved) << "\"\n";
+  std::cout << "configurations: # Wake-up lateness [us]\n";
+  for (const JitterResult& result : results) {
+    std::cout << "  " << result.name << ": {p50: " << result.p50 << ", p99: " << result.p99 << ", max: " << result.max
+              << ", applied: " << (result.applied ? "true" : "false") << "}\n";
+  }
+  return 0;
+}
+
+} // namespace wp5_benchmarks
+
+int main(int argc, char** argv) {
+  wp5_benchmarks::JitterParameters params;
+  try {
+    if (argc > 1) {
+      params.duration = std::max(0.1, std::stod(argv[1]));
+    }
+    if (argc > 2) {
+      params.rate = std::max(1.0, std::stod(argv[2]));
+    }
+    if (argc > 3) {
+      params.priority = std::stoi(argv[3]);
+    }
+  } catch (const std::exception&) {
+    std::cerr << "Usage: rt_jitter_benchmark [duration] [rate] [priority]" << std::endl;
+    return 2;
+  }
+  return wp5_benchmarks::run(params);
+}
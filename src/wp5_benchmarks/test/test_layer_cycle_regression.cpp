@@ -0,0 +1,75 @@
+/**
+ * @file test_layer_cycle_regression.cpp
+ * @brief Regression test of the layer cycle timings against the stored baseline.
+ *
+ * The baseline and the cell are loaded as private parameters by layer_cycle_regression.test. A stage slower than its
+ * baseline median by more than the tolerance of the baseline fails. Timings on a shared machine are noisy, so the cycle
+ * is run up to a few times and a stage only fails when it is slow in every run. Stages missing from the baseline are
+ * reported without failing, until recorded on the reference machine with run_benchmarks.py --update.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include <gtest/gtest.h>
+#include <ros/ros.h>
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <string>
+
+#include "wp5_benchmarks/LayerCycleBenchmark.h"
+
+namespace wp5_benchmarks {
+
+TEST(LayerCycleRegression, StagesWithinBaseline) {
+  ros::NodeHandle nh("~");
+  std::string urdfPath;
+  ASSERT_TRUE(nh.getParam("urdf", urdfPath)) << "Cell description not given.";
+
+  const int nbRepetitions = nh.param("baseline/repetitions", 20);
+  const double tolerance = nh.param("baseline/tolerance", 0.2);
+  const int nbRuns = nh.param("runs", 3);
+
+  // Fastest median of each stage over the runs, stopping once every stage recorded in the baseline is within it
+  std::map<std::string, double> medians;
+  for (int run = 0; run < std::max(1, nbRuns); ++run) {
+    const LayerCycleTimings timings = runLayerCycle(urdfPath, static_cast<std::size_t>(std::max(1, nbRepetitions)));
+
+    bool withinBaseline = true;
+    for (const StageTiming& timing : timings.stages) {
+      const auto it = medians.emplace(timing.name, std::numeric_limits<double>::infinity()).first;
+      it->second = std::min(it->second, timing.median);
+
+      double expected = 0.0;
+      if (nh.getParam("baseline/stages/" + timing.name + "/median", expected) &&
+          it->second > expected * (1.0 + tolerance)) {
+        withinBaseline = false;
+      }
+    }
+    if (withinBaseline) {
+      break;
+    }
+  }
+
+  for (const auto& [name, median] : medians) {
+    double expected = 0.0;
+    if (!nh.getParam("baseline/stages/" + name + "/median", expected)) {
+      ROS_WARN_STREAM("[LayerCycleRegression] - " << name << " not in the baseline, median " << median << " ms.");
+      continue;
+    }
+    ROS_INFO_STREAM("[LayerCycleRegression] - " << name << " median " << median << " ms, baseline " << expected
+                                                << " ms.");
+    EXPECT_LE(median, expected * (1.0 + tolerance))
+        << "Regression of " << name << " beyond " << 100.0 * tolerance << " %.";
+  }
+}
+
+} // namespace wp5_benchmarks
+
+int main(int argc, char** argv) {
+  testing::InitGoogleTest(&argc, argv);
+  ros::init(argc, argv, "layer_cycle_regression");
+  return RUN_ALL_TESTS();
+}
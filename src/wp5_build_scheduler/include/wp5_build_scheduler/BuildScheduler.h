@@ -0,0 +1,33 @@
+/**
+ * @file BuildScheduler.h
+ * @brief ROS service interleaving the layers of the parts on the table from their predicted cooling.
+ *
+ * The thermal model of the parts is configured as for wp5_thermal, under the thermal namespace.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <ros/ros.h>
+#include <wp5_msgs/ScheduleBuild.h>
+
+#include "wp5_build_scheduler/LayerInterleaver.h"
+
+namespace wp5_build_scheduler {
+
+class BuildScheduler {
+public:
+  BuildScheduler(ros::NodeHandle& nh, ros::NodeHandle& pnh);
+
+private:
+  bool scheduleBuildCallback_(wp5_msgs::ScheduleBuild::Request& req, wp5_msgs::ScheduleBuild::Response& res);
+
+  wp5_thermal::ThermalParameters thermal_;
+  InterleaverParameters params_;
+
+  ros::ServiceServer scheduleBuildService_;
+};
+
+} // namespace wp5_build_scheduler
@@ -0,0 +1,118 @@
+/**
+ * @file LayerInterleaver.h
+ * @brief Interleaving of the layers of several parts on the table, so the robot deposits while the others cool.
+ *
+ * Each part follows its own thermal model. After a layer, the part is ready again once its top layer is predicted
+ * below the interpass temperature. The next layer is chosen greedily: among the parts ready by the time the torch
+ * travels to them, the one with the most deposition left, so the parts progress together and hide each other's
+ * dwell. The robot only waits when every part is still cooling, then for the earliest one, and no layer starts above
+ * the interpass temperature unless the dwell before it is capped by maxDwell. Such layers are flagged, never silently
+ * scheduled.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "wp5_thermal/ThermalModel.h"
+
+namespace wp5_build_scheduler {
+
+struct InterleaverParameters {
+  double interpassTemperature = 200.0; // [degC]
+  double maxDwell = 600.0;             // [s]
+  double travelSpeed = 0.25;           // TCP speed between layers [m/s]
+  double layerOverhead = 2.0;          // Retract, approach and arc start of each layer [s]
+};
+
+struct BuildLayer {
+  std::vector<Eigen::Vector3d> path; // Part frame [m]
+  double depositionSpeed = 0.01;     // [m/s]
+};
+
+struct BuildPart {
+  std::string name;
+  Eigen::Isometry3d pose = Eigen::Isometry3d::Identity(); // Part frame in the table frame
+  std::vector<BuildLayer> layers;                          // In the order of deposition
+};
+
+struct ScheduledLayer {
+  std::size_t part = 0;
+  std::size_t layer = 0;
+  double start = 0.0;           // Arc on, from the start of the build [s]
+  double end = 0.0;             // Arc off [s]
+  double ready = 0.0;           // Top layer below the interpass temperature [s]
+  double idle = 0.0;            // Robot waiting for a part to cool before the layer [s]
+  double peakTemperature = 0.0; // [degC]
+  bool aboveInterpass = false;  // Starts above the interpass temperature, the dwell before it capped by maxDwell
+};
+
+class LayerInterleaver {
+public:
+  explicit LayerInterleaver(const wp5_thermal::ThermalParameters& thermal,
+                            const InterleaverParameters& params = InterleaverParameters());
+
+  /**
+   * @brief Add a part to the build, its index being used in the scheduled layers.
+   */
+  std::size_t addPart(const BuildPart& part);
+
+  /**
+   * @brief Choose the next layer and deposit it on the thermal model of its part.
+   *
+   * @return False once every layer is scheduled.
+   */
+  bool scheduleNext(ScheduledLayer& layer);
+
+  /**
+   * @brief Schedule every remaining layer.
+   */
+  std::vector<ScheduledLayer> scheduleAll();
+
+  const BuildPart& getPart(std::size_t part) const { return parts_[part].part; }
+  std::size_t getNbParts() const { return parts_.size(); }
+
+  double getTime() const { return time_; }
+  double getDepositionTime() const { return depositionTime_; }
+  double getIdleTime() const { return idleTime_; }
+  std::size_t getNbAboveInterpass() const { return nbAboveInterpass_; }
+
+  /**
+   * @brief Share of the build spent depositing.
+   */
+  double getDutyCycle() const { return time_ > 0.0 ? depositionTime_ / time_ : 0.0; }
+
+private:
+  struct PartState {
+    BuildPart part;
+    std::unique_ptr<wp5_thermal::ThermalModel> model;
+    std::vector<double> durations; // Deposition time of each layer [s]
+    std::size_t nextLayer = 0;
+    double remaining = 0.0; // Deposition time of the remaining layers [s]
+    double lastEnd = 0.0;
+    double ready = 0.0;
+    bool aboveInterpass = false; // Top layer still above the interpass temperature when ready
+  };
+
+  Eigen::Vector3d layerStart_(const PartState& state) const;
+
+  wp5_thermal::ThermalParameters thermal_;
+  InterleaverParameters params_;
+  std::vector<PartState> parts_;
+
+  double time_ = 0.0;
+  bool hasTorch_ = false;
+  Eigen::Vector3d torch_ = Eigen::Vector3d::Zero(); // Table frame
+  double depositionTime_ = 0.0;
+  double idleTime_ = 0.0;
+  std::size_t nbAboveInterpass_ = 0;
+};
+
+} // namespace wp5_build_scheduler
@@ -0,0 +1,103 @@
+/**
+ * @file BuildScheduler.cpp
+ * @brief ROS service interleaving the layers of the parts on the table from their predicted cooling.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include "wp5_build_scheduler/BuildScheduler.h"
+
+#include <wp5_thermal/DwellPredictor.h>
+
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <string>
+#include <vector>
+
+namespace wp5_build_scheduler {
+
+BuildScheduler::BuildScheduler(ros::NodeHandle& nh, ros::NodeHandle& pnh) :
+    thermal_(wp5_thermal::DwellPredictor::readParameters(ros::NodeHandle(pnh, "thermal"))) {
+  params_.interpassTemperature = pnh.param("interpass_temperature", params_.interpassTemperature);
+  params_.maxDwell = pnh.param("max_dwell", params_.maxDwell);
+  params_.travelSpeed = pnh.param("travel_speed", params_.travelSpeed);
+  params_.layerOverhead = pnh.param("layer_overhead", params_.layerOverhead);
+
+  // Fails early on invalid parameters
+  LayerInterleaver interleaver(thermal_, params_);
+  wp5_thermal::ThermalModel model(thermal_);
+
+  scheduleBuildService_ = nh.advertiseService("schedule_build", &BuildScheduler::scheduleBuildCallback_, this);
+}
+
+bool BuildScheduler::scheduleBuildCallback_(wp5_msgs::ScheduleBuild::Request& req,
+                                            wp5_msgs::ScheduleBuild::Response& res) {
+  try {
+    LayerInterleaver interleaver(thermal_, params_);
+
+    for (const wp5_msgs::BuildPart& msg : req.parts) {
+      BuildPart part;
+      part.name = msg.name;
+      part.pose = Eigen::Translation3d(msg.pose.position.x, msg.pose.position.y, msg.pose.position.z) *
+                  Eigen::Quaterniond(
+                      msg.pose.orientation.w, msg.pose.orientation.x, msg.pose.orientation.y, msg.pose.orientation.z)
+                      .normalized();
+
+      part.layers.reserve(msg.layers.size());
+      for (const geometry_msgs::PoseArray& path : msg.layers) {
+        BuildLayer layer;
+        layer.depositionSpeed = msg.deposition_speed;
+        layer.path.reserve(path.poses.size());
+        for (const geometry_msgs::Pose& pose : path.poses) {
+          layer.path.emplace_back(pose.position.x, pose.position.y, pose.position.z);
+        }
+        part.layers.push_back(std::move(layer));
+      }
+
+      interleaver.addPart(part);
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    const std::vector<ScheduledLayer> schedule = interleaver.scheduleAll();
+    const std::chrono::duration<double> computation = std::chrono::steady_clock::now() - start;
+
+    res.layers.reserve(schedule.size());
+    for (const ScheduledLayer& layer : schedule) {
+      wp5_msgs::ScheduledLayer msg;
+      msg.part = interleaver.getPart(layer.part).name;
+      msg.layer = static_cast<std::uint32_t>(layer.layer);
+      msg.start = layer.start;
+      msg.end = layer.end;
+      msg.ready = layer.ready;
+      msg.idle = layer.idle;
+      msg.peak_temperature = layer.peakTemperature;
+      msg.above_interpass = layer.aboveInterpass;
+      res.layers.push_back(msg);
+    }
+
+    res.makespan = interleaver.getTime();
+    res.idle = interleaver.getIdleTime();
+    res.duty_cycle = interleaver.getDutyCycle();
+    res.success = true;
+
+    ROS_INFO_STREAM("[BuildScheduler] - " << schedule.size() << " layers of " << req.parts.size() << " parts in "
+                                          << res.makespan << " s, duty cycle of " << res.duty_cycle << ", computed in "
+                                          << computation.count() << " s.");
+
+    // Still a valid schedule, but the caller decides whether to raise max_dwell or to accept the hotter layers
+    if (interleaver.getNbAboveInterpass() > 0) {
+      res.message = std::to_string(interleaver.getNbAboveInterpass()) + " layers start above the interpass "
+                    "temperature, their dwell being capped by max_dwell.";
+      ROS_WARN_STREAM("[BuildScheduler] - " << res.message);
+    }
+  } catch (const std::exception& e) {
+    res.success = false;
+    res.message = e.what();
+  }
+
+  return true;
+}
+
+} // namespace wp5_build_scheduler
@@ -0,0 +1,137 @@
+/**
+ * @file LayerInterleaver.cpp
+ * @brief Interleaving of the layers of several parts on the table, so the robot deposits while the others cool.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include "wp5_build_scheduler/LayerInterleaver.h"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace wp5_build_scheduler {
+
+LayerInterleaver::LayerInterleaver(const wp5_thermal::ThermalParameters& thermal, const InterleaverParameters& params) :
+    thermal_(thermal), params_(params) {
+  if (params_.travelSpeed <= 0.0) {
+    throw std::invalid_argument("Travel speed must be positive.");
+  }
+}
+
+std::size_t LayerInterleaver::addPart(const BuildPart& part) {
+  PartState state;
+  state.durations.reserve(part.layers.size());
+  for (const BuildLayer& layer : part.layers) {
+    if (layer.path.empty() || layer.depositionSpeed <= 0.0) {
+      throw std::invalid_argument("Part " + part.name + " has an empty layer or a non positive deposition speed.");
+    }
+
+    double length = 0.0;
+    for (std::size_t i = 1; i < layer.path.size(); ++i) {
+      length += (layer.path[i] - layer.path[i - 1]).norm();
+    }
+    state.durations.push_back(length / layer.depositionSpeed);
+    state.remaining += state.durations.back();
+  }
+
+  state.part = part;
+  state.model = std::make_unique<wp5_thermal::ThermalModel>(thermal_);
+  parts_.push_back(std::move(state));
+  return parts_.size() - 1;
+}
+
+Eigen::Vector3d LayerInterleaver::layerStart_(const PartState& state) const {
+  return state.part.pose * state.part.layers[state.nextLayer].path.front();
+}
+
+bool LayerInterleaver::scheduleNext(ScheduledLayer& layer) {
+  // Parts ready when the torch gets there go first, the most deposition left first so that the parts finish
+  // together, otherwise the earliest start
+  std::size_t best = parts_.size();
+  bool bestReady = false;
+  double bestStart = std::numeric_limits<double>::infinity();
+  double bestArrival = 0.0;
+  for (std::size_t i = 0; i < parts_.size(); ++i) {
+    const PartState& state = parts_[i];
+    if (state.nextLayer >= state.part.layers.size()) {
+      continue;
+    }
+
+    const double travel =
+        hasTorch_ ? (layerStart_(state) - torch_).norm() / params_.travelSpeed + params_.layerOverhead : 0.0;
+    const double arrival = time_ + travel;
+    const double start = std::max(arrival, state.ready);
+    const bool ready = state.ready <= arrival;
+
+    bool better = false;
+    if (best == parts_.size() || ready != bestReady) {
+      better = best == parts_.size() || ready;
+    } else if (ready) {
+      better = state.remaining > parts_[best].remaining ||
+               (state.remaining == parts_[best].remaining && start < bestStart);
+    } else {
+      better = start < bestStart;
+    }
+
+    if (better) {
+      best = i;
+      bestReady = ready;
+      bestStart = start;
+      bestArrival = arrival;
+    }
+  }
+
+  if (best == parts_.size()) {
+    return false;
+  }
+
+  PartState& state = parts_[best];
+  const BuildLayer& buildLayer = state.part.layers[state.nextLayer];
+
+  // Cooling since the previous layer, nothing to do on the bare substrate
+  if (state.nextLayer > 0) {
+    state.model->advance(bestStart - state.lastEnd);
+  }
+  state.model->depositLayer(buildLayer.path, buildLayer.depositionSpeed);
+
+  layer.part = best;
+  layer.layer = state.nextLayer;
+  layer.start = bestStart;
+  layer.end = bestStart + state.durations[state.nextLayer];
+  layer.idle = bestStart - bestArrival;
+  layer.peakTemperature = state.model->topLayerTemperature();
+  layer.aboveInterpass = state.aboveInterpass;
+
+  // A dwell reaching maxDwell does not bring the part back below the interpass temperature, the next layer of the
+  // part is flagged
+  const double dwell = state.model->predictDwell(params_.interpassTemperature, params_.maxDwell);
+  layer.ready = layer.end + dwell;
+  state.aboveInterpass = layer.peakTemperature > params_.interpassTemperature && dwell >= params_.maxDwell;
+
+  state.remaining -= state.durations[state.nextLayer];
+  state.lastEnd = layer.end;
+  state.ready = layer.ready;
+  ++state.nextLayer;
+
+  time_ = layer.end;
+  torch_ = state.part.pose * buildLayer.path.back();
+  hasTorch_ = true;
+  depositionTime_ += layer.end - layer.start;
+  idleTime_ += layer.idle;
+  nbAboveInterpass_ += layer.aboveInterpass ? 1 : 0;
+  return true;
+}
+
+std::vector<ScheduledLayer> LayerInterleaver::scheduleAll() {
+  std::vector<ScheduledLayer> schedule;
+  ScheduledLayer layer;
+  while (scheduleNext(layer)) {
+    schedule.push_back(layer);
+  }
+  return schedule;
+}
+
+} // namespace wp5_build_scheduler
@@ -0,0 +1,22 @@
+/**
+ * @file build_scheduler_node.cpp
+ * @brief ROS node interleaving the layers of the parts on the table from their predicted cooling.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include <ros/ros.h>
+
+#include "wp5_build_scheduler/BuildScheduler.h"
+
+int main(int argc, char** argv) {
+  ros::init(argc, argv, "build_scheduler");
+  ros::NodeHandle nh;
+  ros::NodeHandle pnh("~");
+
+  wp5_build_scheduler::BuildScheduler scheduler(nh, pnh);
+  ros::spin();
+
+  return 0;
+}
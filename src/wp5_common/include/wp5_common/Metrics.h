@@ -0,0 +1,162 @@
+/**
+ * @file Metrics.h
+ * @brief Real-time performance counters of a node, reported on the diagnostics.
+ *
+ * Metrics are registered by name once, then updated from the hot loops with relaxed atomics only, no lock nor
+ * allocation, so a real-time thread can update them. The registry summarizes the window since its previous report on
+ * /diagnostics through diagnostic_updater: rate and jitter histogram of the loops, duration histograms, current and
+ * peak queue depths and dropped messages. Histograms have power of two bins of microseconds.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <diagnostic_updater/diagnostic_updater.h>
+#include <ros/ros.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace wp5_common {
+
+class Histogram {
+public:
+  // Bin 0 below 1 us, bin i in [2^(i-1), 2^i) us, the last one unbounded from 4 s
+  static constexpr std::size_t NB_BINS = 24;
+
+  struct Snapshot {
+    std::array<std::uint64_t, NB_BINS> counts{};
+    std::uint64_t max = 0; // [ns]
+
+    std::uint64_t getCount() const;
+    double quantile(double q) const; // Upper bound of the bin [us]
+  };
+
+  void record(std::uint64_t duration); // [ns]
+
+  /**
+   * @brief Values recorded since the previous snapshot, only taken by the registry.
+   */
+  Snapshot takeSnapshot();
+
+  static double getUpperBound(std::size_t bin); // [us]
+
+private:
+  std::array<std::atomic<std::uint64_t>, NB_BINS> counts_{};
+  std::atomic<std::uint64_t> max_{0};
+  std::array<std::uint64_t, NB_BINS> reported_{};
+};
+
+/**
+ * @brief Rate and jitter of a loop ticked once per iteration, from a single thread.
+ *
+ * The jitter is the deviation of each period from the nominal one, or from the previous period without nominal rate.
+ */
+class LoopMetric {
+public:
+  explicit LoopMetric(double nominalRate) : nominalPeriod_(nominalRate > 0.0 ? 1.0 / nominalRate : 0.0) {}
+
+  void tick();
+
+private:
+  friend class MetricsRegistry;
+
+  double nominalPeriod_; // [s]
+  std::uint64_t previousTime_ = 0;
+  std::uint64_t previousPeriod_ = 0;
+  std::atomic<std::uint64_t> count_{0};
+  Histogram jitter_;
+  std::uint64_t reportedCount_ = 0;
+};
+
+/**
+ * @brief Depth of a queue or pool, with its peak over the window.
+ */
+class Gauge {
+public:
+  void set(std::int64_t value);
+
+private:
+  friend class MetricsRegistry;
+
+  std::atomic<std::int64_t> value_{0};
+  std::atomic<std::int64_t> max_{0};
+};
+
+class Counter {
+public:
+  void add(std::uint64_t count = 1) { count_.fetch_add(count, std::memory_order_relaxed); }
+
+  /**
+   * @brief Count the messages lost before this one from the gap in the header sequence, from a single thread.
+   *
+   * Messages passed by pointer within a nodelet manager keep the sequence set by their publisher, usually zero, and are
+   * not counted.
+   */
+  void addSequenceGap(std::uint32_t sequence);
+
+private:
+  friend class MetricsRegistry;
+
+  std::atomic<std::uint64_t> count_{0};
+  std::uint32_t previousSequence_ = 0;
+  std::uint64_t reportedCount_ = 0;
+};
+
+class MetricsRegistry {
+public:
+  /**
+   * @brief Register a metric, or get the one already registered with this name.
+   *
+   * References stay valid for the lifetime of the registry.
+   */
+  LoopMetric& loop(const std::string& name, double nominalRate = 0.0); // [Hz], zero when unknown
+  Histogram& histogram(const std::string& name);
+  Gauge& gauge(const std::string& name);
+  Counter& counter(const std::string& name);
+  Counter& drops(const std::string& name);
+
+  /**
+   * @brief Report the metrics on /diagnostics, at the diagnostic_period of the private node handle.
+   *
+   * @param name Name of the diagnostic status, prefixed by the node name.
+   */
+  void advertise(ros::NodeHandle& nh, ros::NodeHandle& pnh, const std::string& nodeName, const std::string& name);
+
+  /**
+   * @brief Summary of the window since the previous report, warning on drops and on loops below their nominal rate.
+   */
+  void report(diagnostic_updater::DiagnosticStatusWrapper& status);
+
+private:
+  template <typename Metric>
+  struct Entry {
+    std::string name;
+    std::unique_ptr<Metric> metric;
+  };
+
+  template <typename Metric, typename... Args>
+  static Metric& find_(std::vector<Entry<Metric>>& entries, const std::string& name, Args&&... args);
+
+  void updateDiagnostics_(const ros::WallTimerEvent& event);
+
+  std::mutex mutex_;
+  std::vector<Entry<LoopMetric>> loops_;
+  std::vector<Entry<Histogram>> histograms_;
+  std::vector<Entry<Gauge>> gauges_;
+  std::vector<Entry<Counter>> counters_;
+  std::vector<Entry<Counter>> drops_;
+  std::uint64_t lastReport_ = 0;
+
+  std::unique_ptr<diagnostic_updater::Updater> updater_;
+  ros::WallTimer updateTimer_;
+};
+
+} // namespace wp5_common
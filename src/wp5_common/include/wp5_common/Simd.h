@@ -0,0 +1,24 @@
+/**
+ * @file Simd.h
+ * @brief Kernels multi-versioned for the SIMD instruction sets of the CPU, picked at runtime.
+ *
+ * A function declared with WP5_TARGET_CLONES is compiled for AVX-512, AVX2 and SSE4.2 next to the baseline x86-64
+ * version, and the best one supported by the CPU is resolved when the program is loaded. A single binary then runs on
+ * every cell PC, where -march=native builds crash on CPUs older than the build machine. Clones are never inlined, so
+ * only kernels looping over whole arrays are declared with it. The loops are vectorized from -O3, CMake Release builds.
+ *
+ * Clones are compiled only when WP5_USE_SIMD is defined, by the CMake option of the same name of wp5_common for every
+ * package depending on it, with GCC or Clang from 14 on x86-64. Otherwise the macro expands to nothing.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#if defined(WP5_USE_SIMD) && defined(__x86_64__) && defined(__ELF__) && \
+    (defined(__clang__) ? __clang_major__ >= 14 : defined(__GNUC__))
+#define WP5_TARGET_CLONES __attribute__((target_clones("avx512f", "avx2", "sse4.2", "default")))
+#else
+#define WP5_TARGET_CLONES
+#endif
@@ -0,0 +1,90 @@
+/**
+ * @file TaskScheduler.h
+ * @brief Work-stealing thread pool shared by the parallel loops of a process.
+ *
+ * Every node and nodelet of a process runs its parallel loops on the same workers, so that a nodelet manager hosting
+ * several of them does not oversubscribe the cores with one pool each. The process uses NB_CPU_THREAD threads, the
+ * calling thread of a loop included, or when it is unset or 0 the cores not reserved by RT_CPUS, all of them but two
+ * when none is, see ThreadPlacement.h. The workers are confined to those cores.
+ *
+ * Each worker owns a queue of tasks, pops the newest of its own and steals the oldest of the others when empty. A
+ * parallel loop queues one task per extra thread, each claiming indices from a shared counter until none is left, and
+ * the calling thread claims indices too. Tasks still queued once the indices are exhausted are withdrawn rather than
+ * waited for, so a loop never waits behind unrelated work and loops nest without deadlock.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace wp5_common {
+
+class TaskScheduler {
+public:
+  /**
+   * @brief Scheduler shared by the process, started on first use with threadsFromEnvironment() threads.
+   */
+  static TaskScheduler& instance();
+
+  /**
+   * @brief Threads the process runs its parallel loops on, from NB_CPU_THREAD or the number of worker cores.
+   */
+  static std::size_t threadsFromEnvironment();
+
+  /**
+   * @brief Start nbThreads - 1 workers on the given cores, any of them when empty, the calling thread of each loop
+   * being the last one.
+   */
+  explicit TaskScheduler(std::size_t nbThreads, std::vector<int> cpus = {});
+  ~TaskScheduler();
+
+  TaskScheduler(const TaskScheduler&) = delete;
+  TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+  /**
+   * @brief Run body on every index of [begin, end), on up to maxThreads threads, 0 for all of them.
+   *
+   * Returns once every index is done. The first exception thrown by the body stops the loop and is rethrown here.
+   */
+  void parallelFor(std::size_t begin,
+                   std::size_t end,
+                   const std::function<void(std::size_t)>& body,
+                   std::size_t maxThreads = 0);
+
+  std::size_t getNbThreads() const { return queues_.size() + 1; }
+
+private:
+  struct Loop;
+
+  struct TaskQueue {
+    std::mutex mutex;
+    std::deque<Loop*> tasks;
+  };
+
+  void workerLoop_(std::size_t index);
+  Loop* findTask_(std::size_t index);
+  std::size_t withdraw_(Loop& loop);
+
+  std::vector<std::unique_ptr<TaskQueue>> queues_;
+  std::vector<std::thread> workers_;
+  std::vector<int> cpus_;
+  std::atomic<std::size_t> nextQueue_{0}; // Round robin of the loops started outside of the workers
+
+  std::mutex sleepMutex_;
+  std::condition_variable wakeUp_;
+  std::atomic<std::size_t> nbQueued_{0};
+  bool stopping_ = false;
+};
+
+} // namespace wp5_common
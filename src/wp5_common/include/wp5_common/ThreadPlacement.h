@@ -0,0 +1,64 @@
+/**
+ * @file ThreadPlacement.h
+ * @brief Placement of the threads of a process on the cores, real-time threads apart from the parallel loops.
+ *
+ * RT_CPUS reserves cores to the real-time threads of the cell, the control loop, the arc dispatcher and the Modbus
+ * I/O, as a list such as "2,3" or "2-3". Those threads are pinned to the reserved cores with a SCHED_FIFO priority,
+ * while the workers of the task scheduler are confined to the other cores, so the geometry jobs never preempt a control
+ * cycle. Without RT_CPUS nothing is pinned and only the priorities apply. The reserved cores are best isolated from
+ * the kernel scheduler on the host too, with the isolcpus boot parameter.
+ *
+ * Built with WP5_ROS2, as by the ROS 2 packages compiling it from source, it logs through rclcpp and leaves reading the
+ * placement parameters to the node.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <pthread.h>
+
+#ifndef WP5_ROS2
+#include <ros/ros.h>
+#endif
+
+#include <string>
+#include <vector>
+
+namespace wp5_common {
+
+struct ThreadPlacement {
+  std::vector<int> cpus; // Cores the thread runs on, any of them when empty
+  int priority = 0;      // SCHED_FIFO priority, 0 keeps the default policy
+};
+
+/**
+ * @brief Cores of a list such as "0,2-3", throws std::invalid_argument when malformed.
+ */
+std::vector<int> parseCpuList(const std::string& list);
+
+/**
+ * @brief Cores reserved to the real-time threads by RT_CPUS, among those the process may run on.
+ */
+std::vector<int> reservedCpus();
+
+/**
+ * @brief Cores the process may run on apart from the reserved ones, empty when none is reserved.
+ */
+std::vector<int> workerCpus();
+
+/**
+ * @brief Placement of a real-time thread from the name/priority and name/cpus parameters, the cores defaulting to the
+ * reserved ones.
+ */
+#ifndef WP5_ROS2
+ThreadPlacement readPlacement(const ros::NodeHandle& nh, const std::string& name);
+#endif
+
+/**
+ * @brief Apply a placement to a thread, false with a warning when refused, mostly for lack of CAP_SYS_NICE.
+ */
+bool applyPlacement(pthread_t thread, const ThreadPlacement& placement, const std::string& name);
+
+} // namespace wp5_common
@@ -0,0 +1,41 @@
+/**
+ * @file TraceRecorder.h
+ * @brief Start and stop of the trace recording of a process from the trace_control topic.
+ *
+ * Every node of the cell attaches at startup. A message with record set starts a new recording in every process, the
+ * next one with record cleared stops it and writes the trace of the process to
+ * <trace_directory>/<job>/<node>_<pid>.json, the default directory being $ROS_HOME/traces. The traces of a job are then
+ * merged into one file with scripts/merge_traces.py.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <ros/ros.h>
+#include <wp5_msgs/TraceControl.h>
+
+#include <mutex>
+#include <string>
+
+namespace wp5_common {
+
+class TraceRecorder {
+public:
+  /**
+   * @brief Subscribe to the trace control of the cell, only the first call of a process does.
+   */
+  static void attach(ros::NodeHandle& nh);
+
+private:
+  static TraceRecorder& instance_();
+
+  void controlCallback_(const wp5_msgs::TraceControlConstPtr& msg);
+
+  std::mutex mutex_;
+  ros::Subscriber controlSub_;
+  std::string job_;
+};
+
+} // namespace wp5_common
@@ -0,0 +1,141 @@
+/**
+ * @file Tracing.h
+ * @brief Lightweight tracing of the hot paths, exported as Chrome trace JSON.
+ *
+ * Scopes record their start and duration in a buffer owned by the calling thread, without lock nor allocation once the
+ * buffer of the thread exists, and only while a recording is running. A full buffer drops the next events of its
+ * thread. A thread allocates its buffer on its first event, unless it claimed one beforehand: real-time threads reserve
+ * theirs from their setup, such as the init of a controller, keep the handle and claim it by naming themselves, without
+ * lock nor allocation. The buffers are collected after the recording into the Chrome trace event format, which Perfetto and
+ * chrome://tracing open directly.
+ *
+ * Scopes are compiled only when WP5_ENABLE_TRACING is defined, by the CMake option of the same name of wp5_common for
+ * every package depending on it. Otherwise the macros expand to nothing.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace wp5_common {
+
+struct TraceEvent {
+  const char* category = nullptr; // String literals, only the pointers are stored
+  const char* name = nullptr;
+  std::uint64_t start = 0;    // Steady clock [ns]
+  std::uint64_t duration = 0; // [ns]
+};
+
+class Tracer {
+public:
+  struct ThreadBuffer;
+  using BufferHandle = std::shared_ptr<ThreadBuffer>;
+
+  static Tracer& instance();
+
+  static std::uint64_t now() {
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+  }
+
+  /**
+   * @brief Start a new recording, the events of the previous one are discarded.
+   */
+  void start();
+  void stop();
+  bool recording() const { return recording_.load(std::memory_order_relaxed); }
+
+  /**
+   * @brief Record an event of the calling thread, whose buffer is allocated on its first event unless it claimed one.
+   */
+  void record(const TraceEvent& event);
+
+  /**
+   * @brief Allocate a buffer for a thread that will trace from a real-time context, to be claimed by that thread only.
+   */
+  BufferHandle reserveBuffer();
+
+  /**
+   * @brief Name of the calling thread in the exported trace, a string literal whose pointer only is stored.
+   *
+   * @param buffer Reserved buffer claimed by the calling thread, without lock nor allocation. Kept when another thread
+   * already claimed it, the calling thread then allocates its own.
+   */
+  void setThreadName(const char* name, const BufferHandle& buffer = nullptr);
+
+  /**
+   * @brief Export the events of the last recording, to be called once it is stopped.
+   *
+   * @return Number of events written.
+   */
+  std::size_t writeChromeTrace(std::ostream& stream) const;
+  bool writeChromeTrace(const std::string& path) const;
+
+  std::uint64_t getNbDropped() const;
+
+  Tracer(const Tracer&) = delete;
+  Tracer& operator=(const Tracer&) = delete;
+
+private:
+  Tracer() = default;
+
+  static BufferHandle& currentBuffer_();
+  ThreadBuffer& threadBuffer_();
+
+  static constexpr std::size_t BUFFER_CAPACITY = 1 << 16; // Events per thread and recording
+
+  std::atomic<bool> recording_{false};
+  std::atomic<std::uint32_t> epoch_{0};
+
+  mutable std::mutex registryMutex_;
+  std::vector<std::shared_ptr<ThreadBuffer>> buffers_;
+};
+
+/**
+ * @brief Event covering the lifetime of the scope, nothing is recorded when no recording is running at its start.
+ */
+class TraceScope {
+public:
+  TraceScope(const char* category, const char* name) :
+      category_(category), name_(name), start_(Tracer::instance().recording() ? Tracer::now() : 0) {}
+
+  ~TraceScope() {
+    if (start_ != 0) {
+      Tracer::instance().record(TraceEvent{category_, name_, start_, Tracer::now() - start_});
+    }
+  }
+
+  TraceScope(const TraceScope&) = delete;
+  TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+  const char* category_;
+  const char* name_;
+  std::uint64_t start_;
+};
+
+} // namespace wp5_common
+
+#ifdef WP5_ENABLE_TRACING
+#define WP5_TRACE_CONCAT_IMPL(a, b) a##b
+#define WP5_TRACE_CONCAT(a, b) WP5_TRACE_CONCAT_IMPL(a, b)
+#define WP5_TRACE_SCOPE(category, name) \
+  const ::wp5_common::TraceScope WP5_TRACE_CONCAT(wp5TraceScope, __LINE__)(category, name)
+#define WP5_TRACE_THREAD(...) ::wp5_common::Tracer::instance().setThreadName(__VA_ARGS__)
+#define WP5_TRACE_RESERVE(buffer) buffer = ::wp5_common::Tracer::instance().reserveBuffer()
+#else
+#define WP5_TRACE_SCOPE(category, name) static_cast<void>(0)
+#define WP5_TRACE_THREAD(...) static_cast<void>(0)
+#define WP5_TRACE_RESERVE(buffer) static_cast<void>(0)
+#endif
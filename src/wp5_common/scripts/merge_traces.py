@@ -0,0 +1,51 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+# Merge the traces written by the nodes for a job into a single Chrome trace, to open in Perfetto or chrome://tracing.
+# Author: lmunier - <lmunier@protonmail.com>
+# Date: 2026-10-17
+#
+# Every process writes <node>_<pid>.json in the directory of the job. Timestamps come from the monotonic clock, so the
+# processes of one machine share the same time base and their events are merged as they are, each process being named
+# after its node.
+
+import argparse
+import glob
+import json
+import os
+import sys
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Merge the traces of a job into one Chrome trace.")
+    parser.add_argument("job_directory", help="Directory of the job, with one trace per process")
+    parser.add_argument("-o", "--output", help="Merged trace, <job_directory>.json by default")
+    args = parser.parse_args()
+
+    job_directory = os.path.normpath(args.job_directory)
+    paths = sorted(glob.glob(os.path.join(job_directory, "*.json")))
+    if not paths:
+        print("[merge_traces] - No trace in {}.".format(job_directory), file=sys.stderr)
+        return 1
+
+    events = []
+    for path in paths:
+        with open(path) as trace:
+            process_events = json.load(trace).get("traceEvents", [])
+
+        node = os.path.splitext(os.path.basename(path))[0].rsplit("_", 1)[0]
+        pids = {event["pid"] for event in process_events if "pid" in event}
+        for pid in pids:
+            events.append({"ph": "M", "name": "process_name", "pid": pid, "args": {"name": node}})
+        events.extend(process_events)
+
+    output = args.output or job_directory + ".json"
+    with open(output, "w") as trace:
+        json.dump({"displayTimeUnit": "ms", "traceEvents": events}, trace)
+
+    print("[merge_traces] - {} events of {} processes merged into {}.".format(len(events), len(paths), output))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
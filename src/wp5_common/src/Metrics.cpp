@@ -0,0 +1,242 @@
+/**
+ * @file Metrics.cpp
+ * @brief Real-time performance counters of a node, reported on the diagnostics.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include "wp5_common/Metrics.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <sstream>
+
+namespace wp5_common {
+
+namespace {
+
+std::uint64_t steadyNow() {
+  return static_cast<std::uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+}
+
+template <typename T>
+void storeMax(std::atomic<T>& max, T value) {
+  T current = max.load(std::memory_order_relaxed);
+  while (value > current && !max.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+  }
+}
+
+void addHistogram(diagnostic_updater::DiagnosticStatusWrapper& status,
+                  const std::string& name,
+                  const Histogram::Snapshot& snapshot) {
+  if (snapshot.getCount() == 0) {
+    return;
+  }
+
+  status.addf(name + " p50 [us]", "%.0f", snapshot.quantile(0.5));
+  status.addf(name + " p99 [us]", "%.0f", snapshot.quantile(0.99));
+  status.addf(name + " max [us]", "%.1f", snapshot.max * 1e-3);
+
+  // Non-empty bins, by upper bound
+  std::ostringstream bins;
+  for (std::size_t i = 0; i < Histogram::NB_BINS; ++i) {
+    if (snapshot.counts[i] == 0) {
+      continue;
+    }
+    if (bins.tellp() > 0) {
+      bins << " ";
+    }
+    if (i + 1 < Histogram::NB_BINS) {
+      bins << "<" << Histogram::getUpperBound(i) << ":" << snapshot.counts[i];
+    } else {
+      bins << ">=" << Histogram::getUpperBound(i - 1) << ":" << snapshot.counts[i];
+    }
+  }
+  status.add(name + " histogram [us]", bins.str());
+}
+
+} // namespace
+
+std::uint64_t Histogram::Snapshot::getCount() const {
+  std::uint64_t count = 0;
+  for (std::uint64_t binCount : counts) {
+    count += binCount;
+  }
+  return count;
+}
+
+double Histogram::Snapshot::quantile(double q) const {
+  const std::uint64_t count = getCount();
+  const double rank = std::ceil(std::clamp(q, 0.0, 1.0) * count);
+
+  std::uint64_t cumulated = 0;
+  for (std::size_t i = 0; i + 1 < NB_BINS; ++i) {
+    cumulated += counts[i];
+    if (cumulated > 0 && cumulated >= rank) {
+      return getUpperBound(i);
+    }
+  }
+  return max * 1e-3;
+}
+
+void Histogram::record(std::uint64_t duration) {
+  const std::uint64_t microseconds = duration / 1000;
+  const std::size_t bin = microseconds == 0
+                              ? 0
+                              : std::min<std::size_t>(NB_BINS - 1, 64 - __builtin_clzll(microseconds));
+  counts_[bin].fetch_add(1, std::memory_order_relaxed);
+  storeMax(max_, duration);
+}
+
+Histogram::Snapshot Histogram::takeSnapshot() {
+  Snapshot snapshot;
+  for (std::size_t i = 0; i < NB_BINS; ++i) {
+    const std::uint64_t count = counts_[i].load(std::memory_order_relaxed);
+    snapshot.counts[i] = count - reported_[i];
+    reported_[i] = count;
+  }
+  snapshot.max = max_.exchange(0, std::memory_order_relaxed);
+  return snapshot;
+}
+
+double Histogram::getUpperBound(std::size_t bin) { return static_cast<double>(std::uint64_t(1) << bin); }
+
+void LoopMetric::tick() {
+  const std::uint64_t now = steadyNow();
+  if (previousTime_ != 0) {
+    const std::uint64_t period = now - previousTime_;
+    const double reference = nominalPeriod_ > 0.0 ? nominalPeriod_ * 1e9 : static_cast<double>(previousPeriod_);
+    if (nominalPeriod_ > 0.0 || previousPeriod_ != 0) {
+      jitter_.record(static_cast<std::uint64_t>(std::abs(static_cast<double>(period) - reference)));
+    }
+    previousPeriod_ = period;
+  }
+  previousTime_ = now;
+  count_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void Gauge::set(std::int64_t value) {
+  value_.store(value, std::memory_order_relaxed);
+  storeMax(max_, value);
+}
+
+void Counter::addSequenceGap(std::uint32_t sequence) {
+  // Sequences only increase, a lower one is a restarted publisher
+  if (previousSequence_ != 0 && sequence > previousSequence_ + 1) {
+    add(sequence - previousSequence_ - 1);
+  }
+  previousSequence_ = sequence;
+}
+
+template <typename Metric, typename... Args>
+Metric& MetricsRegistry::find_(std::vector<Entry<Metric>>& entries, const std::string& name, Args&&... args) {
+  for (Entry<Metric>& entry : entries) {
+    if (entry.name == name) {
+      return *entry.metric;
+    }
+  }
+  entries.push_back(Entry<Metric>{name, std::make_unique<Metric>(std::forward<Args>(args)...)});
+  return *entries.back().metric;
+}
+
+LoopMetric& MetricsRegistry::loop(const std::string& name, double nominalRate) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return find_(loops_, name, nominalRate);
+}
+
+Histogram& MetricsRegistry::histogram(const std::string& name) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return find_(histograms_, name);
+}
+
+Gauge& MetricsRegistry::gauge(const std::string& name) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return find_(gauges_, name);
+}
+
+Counter& MetricsRegistry::counter(const std::string& name) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return find_(counters_, name);
+}
+
+Counter& MetricsRegistry::drops(const std::string& name) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return find_(drops_, name);
+}
+
+void MetricsRegistry::advertise(ros::NodeHandle& nh,
+                                ros::NodeHandle& pnh,
+                                const std::string& nodeName,
+                                const std::string& name) {
+  updater_ = std::make_unique<diagnostic_updater::Updater>(nh, pnh, nodeName);
+  updater_->setHardwareID(nodeName);
+  updater_->add(name, this, &MetricsRegistry::report);
+
+  // Forced updates, the period of the updater would skip every other timer event
+  updateTimer_ = nh.createWallTimer(
+      ros::WallDuration(std::max(0.1, updater_->getPeriod())), &MetricsRegistry::updateDiagnostics_, this);
+}
+
+void MetricsRegistry::updateDiagnostics_(const ros::WallTimerEvent& /*event*/) { updater_->force_update(); }
+
+void MetricsRegistry::report(diagnostic_updater::DiagnosticStatusWrapper& status) {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  const std::uint64_t now = steadyNow();
+  const double window = lastReport_ != 0 ? (now - lastReport_) * 1e-9 : 0.0;
+  lastReport_ = now;
+
+  status.summary(diagnostic_msgs::DiagnosticStatus::OK, "Nominal");
+
+  for (Entry<LoopMetric>& entry : loops_) {
+    LoopMetric& loop = *entry.metric;
+    const std::uint64_t count = loop.count_.load(std::memory_order_relaxed);
+    const std::uint64_t nbTicks = count - loop.reportedCount_;
+    loop.reportedCount_ = count;
+
+    const double rate = window > 0.0 ? nbTicks / window : 0.0;
+    status.addf(entry.name + " rate [Hz]", "%.1f", rate);
+    addHistogram(status, entry.name + " jitter", loop.jitter_.takeSnapshot());
+
+    // An idle loop is not late
+    if (loop.nominalPeriod_ > 0.0 && nbTicks > 0 && window > 0.0 && rate < 0.9 / loop.nominalPeriod_) {
+      status.mergeSummaryf(
+          diagnostic_msgs::DiagnosticStatus::WARN, "%s below its nominal rate", entry.name.c_str());
+    }
+  }
+
+  for (Entry<Histogram>& entry : histograms_) {
+    addHistogram(status, entry.name, entry.metric->takeSnapshot());
+  }
+
+  for (Entry<Gauge>& entry : gauges_) {
+    const std::int64_t value = entry.metric->value_.load(std::memory_order_relaxed);
+    status.add(entry.name, value);
+    status.add(entry.name + " max", entry.metric->max_.exchange(value, std::memory_order_relaxed));
+  }
+
+  for (Entry<Counter>& entry : counters_) {
+    status.add(entry.name, entry.metric->count_.load(std::memory_order_relaxed));
+  }
+
+  for (Entry<Counter>& entry : drops_) {
+    Counter& drops = *entry.metric;
+    const std::uint64_t count = drops.count_.load(std::memory_order_relaxed);
+    const std::uint64_t nbDropped = count - drops.reportedCount_;
+    drops.reportedCount_ = count;
+
+    status.add(entry.name + " dropped", count);
+    if (nbDropped > 0) {
+      status.mergeSummaryf(diagnostic_msgs::DiagnosticStatus::WARN,
+                           "%llu %s dropped",
+                           static_cast<unsigned long long>(nbDropped),
+                           entry.name.c_str());
+    }
+  }
+}
+
+} // namespace wp5_common
@@ -0,0 +1,229 @@
+/**
+ * @file TaskScheduler.cpp
+ * @brief Work-stealing thread pool shared by the parallel loops of a process.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include "wp5_common/TaskScheduler.h"
+
+#include <ros/ros.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <exception>
+#include <iterator>
+#include <string>
+#include <utility>
+
+#include "wp5_common/ThreadPlacement.h"
+#include "wp5_common/Tracing.h"
+
+namespace wp5_common {
+
+/**
+ * A parallel loop, living on the stack of its calling thread. Its queued tasks all point to it, the calling thread
+ * returns only once none of them is queued or running anymore.
+ */
+struct TaskScheduler::Loop {
+  const std::function<void(std::size_t)>* body = nullptr;
+  std::atomic<std::size_t> next{0};
+  std::size_t end = 0;
+
+  std::mutex mutex;
+  std::condition_variable done;
+  std::size_t nbPending = 0; // Tasks queued or running, guarded by the mutex
+  std::exception_ptr error;  // Guarded by the mutex
+
+  void run() {
+    try {
+      for (std::size_t i = next++; i < end; i = next++) {
+        (*body)(i);
+      }
+    } catch (...) {
+      next = end;
+      std::lock_guard<std::mutex> lock(mutex);
+      if (!error) {
+        error = std::current_exception();
+      }
+    }
+  }
+
+  void finish(std::size_t nbTasks) {
+    std::lock_guard<std::mutex> lock(mutex);
+    nbPending -= nbTasks;
+    if (nbPending == 0) {
+      done.notify_all();
+    }
+  }
+};
+
+namespace {
+
+// Worker of the calling thread, so that nested loops queue their tasks on it
+thread_local const TaskScheduler* currentScheduler = nullptr;
+thread_local std::size_t currentWorker = 0;
+
+} // namespace
+
+TaskScheduler& TaskScheduler::instance() {
+  static TaskScheduler scheduler(threadsFromEnvironment(), workerCpus());
+  return scheduler;
+}
+
+std::size_t TaskScheduler::threadsFromEnvironment() {
+  // The cores not reserved to the real-time threads, all of them but two when none is
+  const std::size_t nbCores = std::max(1u, std::thread::hardware_concurrency());
+  const std::size_t nbWorkerCpus = workerCpus().size();
+  const std::size_t fallback = nbWorkerCpus > 0 ? nbWorkerCpus : (nbCores > 2 ? nbCores - 2 : 1);
+
+  const char* value = std::getenv("NB_CPU_THREAD");
+  if (value == nullptr || *value == '\0') {
+    return fallback;
+  }
+
+  char* end = nullptr;
+  const long nbThreads = std::strtol(value, &end, 10);
+  if (*end != '\0' || nbThreads < 0) {
+    ROS_WARN_STREAM("[TaskScheduler] - NB_CPU_THREAD=" << value << " is not a number of threads, using " << fallback
+                                                       << ".");
+    return fallback;
+  }
+  return nbThreads == 0 ? fallback : static_cast<std::size_t>(nbThreads);
+}
+
+TaskScheduler::TaskScheduler(std::size_t nbThreads, std::vector<int> cpus) : cpus_(std::move(cpus)) {
+  const std::size_t nbWorkers = std::max<std::size_t>(1, nbThreads) - 1;
+  for (std::size_t i = 0; i < nbWorkers; ++i) {
+    queues_.push_back(std::make_unique<TaskQueue>());
+  }
+  workers_.reserve(nbWorkers);
+  for (std::size_t i = 0; i < nbWorkers; ++i) {
+    workers_.emplace_back(&TaskScheduler::workerLoop_, this, i);
+  }
+}
+
+TaskScheduler::~TaskScheduler() {
+  {
+    std::lock_guard<std::mutex> lock(sleepMutex_);
+    stopping_ = true;
+  }
+  wakeUp_.notify_all();
+  for (std::thread& worker : workers_) {
+    worker.join();
+  }
+}
+
+void TaskScheduler::parallelFor(std::size_t begin,
+                                std::size_t end,
+                                const std::function<void(std::size_t)>& body,
+                                std::size_t maxThreads) {
+  if (begin >= end) {
+    return;
+  }
+
+  const std::size_t nbThreads =
+      std::min({maxThreads ? maxThreads : getNbThreads(), getNbThreads(), end - begin});
+  const std::size_t nbTasks = nbThreads - 1;
+
+  Loop loop;
+  loop.body = &body;
+  loop.next = begin;
+  loop.end = end;
+  loop.nbPending = nbTasks;
+
+  if (nbTasks > 0) {
+    // Counted before being queued, a worker may pop a task as soon as it is visible
+    nbQueued_ += nbTasks;
+    if (currentScheduler == this) {
+      TaskQueue& queue = *queues_[currentWorker];
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      queue.tasks.insert(queue.tasks.end(), nbTasks, &loop);
+    } else {
+      for (std::size_t i = 0; i < nbTasks; ++i) {
+        TaskQueue& queue = *queues_[nextQueue_++ % queues_.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back(&loop);
+      }
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(sleepMutex_);
+    }
+    wakeUp_.notify_all();
+  }
+
+  loop.run();
+
+  if (nbTasks > 0) {
+    // Every index is claimed, the tasks not started yet have nothing left to do
+    loop.finish(withdraw_(loop));
+    std::unique_lock<std::mutex> lock(loop.mutex);
+    loop.done.wait(lock, [&loop]() { return loop.nbPending == 0; });
+  }
+
+  if (loop.error) {
+    std::rethrow_exception(loop.error);
+  }
+}
+
+void TaskScheduler::workerLoop_(std::size_t index) {
+  WP5_TRACE_THREAD("task_worker");
+  if (!cpus_.empty()) {
+    applyPlacement(pthread_self(), ThreadPlacement{cpus_, 0}, "Task worker " + std::to_string(index));
+  }
+  currentScheduler = this;
+  currentWorker = index;
+
+  while (true) {
+    if (Loop* loop = findTask_(index)) {
+      loop->run();
+      loop->finish(1);
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(sleepMutex_);
+    wakeUp_.wait(lock, [this]() { return stopping_ || nbQueued_ > 0; });
+    if (stopping_) {
+      return;
+    }
+  }
+}
+
+TaskScheduler::Loop* TaskScheduler::findTask_(std::size_t index) {
+  // Newest task of its own queue first, the oldest of the others otherwise
+  for (std::size_t offset = 0; offset < queues_.size(); ++offset) {
+    TaskQueue& queue = *queues_[(index + offset) % queues_.size()];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) {
+      continue;
+    }
+
+    Loop* loop = nullptr;
+    if (offset == 0) {
+      loop = queue.tasks.back();
+      queue.tasks.pop_back();
+    } else {
+      loop = queue.tasks.front();
+      queue.tasks.pop_front();
+    }
+    --nbQueued_;
+    return loop;
+  }
+  return nullptr;
+}
+
+std::size_t TaskScheduler::withdraw_(Loop& loop) {
+  std::size_t nbWithdrawn = 0;
+  for (const std::unique_ptr<TaskQueue>& queue : queues_) {
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    const auto it = std::remove(queue->tasks.begin(), queue->tasks.end(), &loop);
+    nbWithdrawn += std::distance(it, queue->tasks.end());
+    queue->tasks.erase(it, queue->tasks.end());
+  }
+  nbQueued_ -= nbWithdrawn;
+  return nbWithdrawn;
+}
+
+} // namespace wp5_common
@@ -0,0 +1,242 @@
+/**
+ * @file ThreadPlacement.cpp
+ * @brief Placement of the threads of a process on the cores, real-time threads apart from the parallel loops.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include "wp5_common/ThreadPlacement.h"
+
+#include <sched.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+
+#ifdef WP5_ROS2
+#include <rclcpp/logging.hpp>
+#define PLACEMENT_WARN_STREAM(stream) RCLCPP_WARN_STREAM(rclcpp::get_logger("wp5_common"), stream)
+#else
+#define PLACEMENT_WARN_STREAM(stream) ROS_WARN_STREAM(stream)
+#endif
+
+namespace wp5_common {
+
+namespace {
+
+std::vector<int> parseCpuListOrEmpty(const std::string& list) {
+  try {
+    return parseCpuList(list);
+  } catch (const std::invalid_argument&) {
+    return {};
+  }
+}
+
+// Cores of the cpuset of the process, empty when not readable. The cores isolated with isolcpus are missing from the
+// default affinity of every thread but stay in the cpuset, so the real-time threads can still be pinned to them.
+std::vector<int> cpusetCpus() {
+  std::ifstream cgroups("/proc/self/cgroup");
+  std::string line;
+  while (std::getline(cgroups, line)) {
+    // "0::<path>" for cgroup v2, "<id>:<controllers>:<path>" for cgroup v1
+    const std::size_t first = line.find(':');
+    const std::size_t second = line.find(':', first + 1);
+    if (first == std::string::npos || second == std::string::npos) {
+      continue;
+    }
+
+    const std::string controllers = line.substr(first + 1, second - first - 1);
+    const std::string path = line.substr(second + 1);
+    std::string file;
+    if (controllers.empty()) {
+      file = "/sys/fs/cgroup" + path + "/cpuset.cpus.effective";
+    } else if (("," + controllers + ",").find(",cpuset,") != std::string::npos) {
+      file = "/sys/fs/cgroup/cpuset" + path + "/cpuset.effective_cpus";
+    } else {
+      continue;
+    }
+
+    // Inside a cgroup v1 container the path is the one of the host, missing from the mounted hierarchy
+    std::ifstream cpuset(file);
+    std::string list;
+    if (std::getline(cpuset, list)) {
+      const std::vector<int> cpus = parseCpuListOrEmpty(list);
+      if (!cpus.empty()) {
+        return cpus;
+      }
+    }
+  }
+  return {};
+}
+
+std::vector<int> affinityCpus() {
+  std::vector<int> cpus;
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+      if (CPU_ISSET(cpu, &set)) {
+        cpus.push_back(cpu);
+      }
+    }
+  }
+  return cpus;
+}
+
+// Cores the threads of the process may be pinned to, from its cpuset or else the affinity of the process when first
+// asked, before any thread of it is pinned. A cpuset not covering the affinity is not the one of the process, e.g. a
+// hierarchy resolved in the wrong cgroup namespace, and is ignored.
+const std::vector<int>& allowedCpus() {
+  static const std::vector<int> cpus = []() {
+    const std::vector<int> affinity = affinityCpus();
+    const std::vector<int> cpuset = cpusetCpus();
+    if (!cpuset.empty() && std::includes(cpuset.begin(), cpuset.end(), affinity.begin(), affinity.end())) {
+      return cpuset;
+    }
+    return affinity;
+  }();
+  return cpus;
+}
+
+int parseCpu(const std::string& token, const std::string& list) {
+  char* end = nullptr;
+  const long cpu = std::strtol(token.c_str(), &end, 10);
+  if (token.empty() || *end != '\0' || cpu < 0 || cpu >= CPU_SETSIZE) {
+    throw std::invalid_argument("[ThreadPlacement] - " + list + " is not a list of cores.");
+  }
+  return static_cast<int>(cpu);
+}
+
+std::string toString(const std::vector<int>& cpus) {
+  std::ostringstream stream;
+  for (std::size_t i = 0; i < cpus.size(); ++i) {
+    stream << (i ? "," : "") << cpus[i];
+  }
+  return stream.str();
+}
+
+} // namespace
+
+std::vector<int> parseCpuList(const std::string& list) {
+  std::vector<int> cpus;
+  std::istringstream stream(list);
+  std::string range;
+  while (std::getline(stream, range, ',')) {
+    range.erase(std::remove_if(range.begin(), range.end(), [](unsigned char c) { return std::isspace(c); }),
+                range.end());
+    if (range.empty()) {
+      continue;
+    }
+
+    const std::size_t dash = range.find('-');
+    const int first = parseCpu(range.substr(0, dash), list);
+    const int last = dash == std::string::npos ? first : parseCpu(range.substr(dash + 1), list);
+    if (last < first) {
+      throw std::invalid_argument("[ThreadPlacement] - " + list + " is not a list of cores.");
+    }
+    for (int cpu = first; cpu <= last; ++cpu) {
+      cpus.push_back(cpu);
+    }
+  }
+
+  std::sort(cpus.begin(), cpus.end());
+  cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+  return cpus;
+}
+
+std::vector<int> reservedCpus() {
+  // Read once, so a misconfiguration is only reported once per process
+  static const std::vector<int> cpus = []() -> std::vector<int> {
+    const char* value = std::getenv("RT_CPUS");
+    if (value == nullptr) {
+      return {};
+    }
+
+    std::vector<int> requested;
+    try {
+      requested = parseCpuList(value);
+    } catch (const std::invalid_argument&) {
+      PLACEMENT_WARN_STREAM("[ThreadPlacement] - RT_CPUS=" << value << " is not a list of cores, none reserved.");
+      return {};
+    }
+
+    const std::vector<int>& allowed = allowedCpus();
+    std::vector<int> reserved;
+    std::set_intersection(
+        requested.begin(), requested.end(), allowed.begin(), allowed.end(), std::back_inserter(reserved));
+    if (reserved.size() != requested.size()) {
+      PLACEMENT_WARN_STREAM("[ThreadPlacement] - RT_CPUS=" << value << " outside of the cores of the process ("
+                                                           << toString(allowed) << "), reserving "
+                                                           << toString(reserved) << ".");
+    }
+    if (!reserved.empty() && reserved.size() == allowed.size()) {
+      PLACEMENT_WARN_STREAM("[ThreadPlacement] - RT_CPUS=" << value << " reserves every core, none reserved.");
+      return {};
+    }
+    return reserved;
+  }();
+  return cpus;
+}
+
+std::vector<int> workerCpus() {
+  const std::vector<int> reserved = reservedCpus();
+  if (reserved.empty()) {
+    return {};
+  }
+
+  const std::vector<int>& allowed = allowedCpus();
+  std::vector<int> cpus;
+  std::set_difference(allowed.begin(), allowed.end(), reserved.begin(), reserved.end(), std::back_inserter(cpus));
+  return cpus;
+}
+
+#ifndef WP5_ROS2
+ThreadPlacement readPlacement(const ros::NodeHandle& nh, const std::string& name) {
+  ThreadPlacement placement;
+  placement.priority = nh.param(name + "/priority", placement.priority);
+  if (!nh.getParam(name + "/cpus", placement.cpus) || placement.cpus.empty()) {
+    placement.cpus = reservedCpus();
+  }
+  return placement;
+}
+#endif
+
+bool applyPlacement(pthread_t thread, const ThreadPlacement& placement, const std::string& name) {
+  bool applied = true;
+
+  if (!placement.cpus.empty()) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (const int cpu : placement.cpus) {
+      if (cpu >= 0 && cpu < CPU_SETSIZE) {
+        CPU_SET(cpu, &set);
+      }
+    }
+    const int error = pthread_setaffinity_np(thread, sizeof(set), &set);
+    if (error != 0) {
+      PLACEMENT_WARN_STREAM("[ThreadPlacement] - " << name << " not pinned to cores " << toString(placement.cpus)
+                                                   << ": " << std::strerror(error) << ".");
+      applied = false;
+    }
+  }
+
+  if (placement.priority > 0) {
+    sched_param param{};
+    param.sched_priority = placement.priority;
+    const int error = pthread_setschedparam(thread, SCHED_FIFO, &param);
+    if (error != 0) {
+      PLACEMENT_WARN_STREAM("[ThreadPlacement] - " << name << " kept on the default policy, SCHED_FIFO refused: "
+                                                   << std::strerror(error) << ".");
+      applied = false;
+    }
+  }
+  return applied;
+}
+
+} // namespace wp5_common
@@ -0,0 +1,86 @@
+/**
+ * @file TraceRecorder.cpp
+ * @brief Start and stop of the trace recording of a process from the trace_control topic.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include "wp5_common/TraceRecorder.h"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+
+#include "wp5_common/Tracing.h"
+
+namespace wp5_common {
+
+namespace {
+
+std::string defaultTraceDirectory() {
+  const char* rosHome = std::getenv("ROS_HOME");
+  const char* home = std::getenv("HOME");
+  const std::string root = rosHome ? rosHome : std::string(home ? home : ".") + "/.ros";
+  return root + "/traces";
+}
+
+} // namespace
+
+TraceRecorder& TraceRecorder::instance_() {
+  static TraceRecorder recorder;
+  return recorder;
+}
+
+void TraceRecorder::attach(ros::NodeHandle& nh) {
+  TraceRecorder& recorder = instance_();
+  std::lock_guard<std::mutex> lock(recorder.mutex_);
+  if (recorder.controlSub_) {
+    return;
+  }
+
+  // Global topic, shared by all the nodes whatever their namespace
+  recorder.controlSub_ = nh.subscribe("/trace_control", 4, &TraceRecorder::controlCallback_, &recorder);
+}
+
+void TraceRecorder::controlCallback_(const wp5_msgs::TraceControlConstPtr& msg) {
+  Tracer& tracer = Tracer::instance();
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  if (msg->record) {
+    job_ = msg->job.empty() ? "default" : msg->job;
+    tracer.start();
+    ROS_INFO_STREAM("[TraceRecorder] - Recording trace of job " << job_ << ".");
+    return;
+  }
+
+  if (!tracer.recording()) {
+    return;
+  }
+  tracer.stop();
+
+  std::string node = ros::this_node::getName();
+  std::replace(node.begin(), node.end(), '/', '_');
+  node.erase(0, node.find_first_not_of('_'));
+
+  const std::filesystem::path directory =
+      std::filesystem::path(ros::param::param<std::string>("/trace_directory", defaultTraceDirectory())) / job_;
+  std::error_code ec;
+  std::filesystem::create_directories(directory, ec);
+
+  const std::string path = (directory / (node + "_" + std::to_string(getpid()) + ".json")).string();
+  if (ec || !tracer.writeChromeTrace(path)) {
+    ROS_ERROR_STREAM("[TraceRecorder] - Cannot write trace " << path << ".");
+    return;
+  }
+
+  const std::uint64_t dropped = tracer.getNbDropped();
+  if (dropped > 0) {
+    ROS_WARN_STREAM("[TraceRecorder] - " << dropped << " events dropped, thread buffers full.");
+  }
+  ROS_INFO_STREAM("[TraceRecorder] - Trace written to " << path << ".");
+}
+
+} // namespace wp5_common
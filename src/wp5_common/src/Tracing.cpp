@@ -0,0 +1,211 @@
+/**
+ * @file Tracing.cpp
+ * @brief Lightweight tracing of the hot paths, exported as Chrome trace JSON.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include "wp5_common/Tracing.h"
+
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <iomanip>
+
+namespace wp5_common {
+
+/**
+ * Only the owning thread writes its events: it resets its buffer when it sees a new recording and publishes each event
+ * by a release store of the size, so the exporter reads the events below the size without lock.
+ */
+struct Tracer::ThreadBuffer {
+  std::vector<TraceEvent> events;
+  std::atomic<std::size_t> size{0};
+  std::atomic<std::uint32_t> epoch{0};
+  std::atomic<std::uint64_t> dropped{0};
+
+  std::atomic<bool> owned{false}; // Claimed by a thread, a reserved buffer is not until then
+  std::atomic<long> threadId{0};
+  std::atomic<const char*> name{nullptr};
+};
+
+namespace {
+
+void writeEscaped(std::ostream& stream, const char* text) {
+  stream << '"';
+  for (const char* c = text ? text : ""; *c != '\0'; ++c) {
+    if (*c == '"' || *c == '\\') {
+      stream << '\\';
+    }
+    stream << *c;
+  }
+  stream << '"';
+}
+
+} // namespace
+
+Tracer& Tracer::instance() {
+  static Tracer tracer;
+  return tracer;
+}
+
+void Tracer::start() {
+  {
+    // Buffers of the threads that exited are dropped with the previous recording
+    std::lock_guard<std::mutex> lock(registryMutex_);
+    std::vector<std::shared_ptr<ThreadBuffer>> alive;
+    for (const std::shared_ptr<ThreadBuffer>& buffer : buffers_) {
+      // Also held by a thread or by the handle of a reserved buffer
+      if (buffer.use_count() > 1) {
+        alive.push_back(buffer);
+      }
+    }
+    buffers_.swap(alive);
+  }
+
+  epoch_.fetch_add(1, std::memory_order_acq_rel);
+  recording_.store(true, std::memory_order_release);
+}
+
+void Tracer::stop() { recording_.store(false, std::memory_order_release); }
+
+Tracer::BufferHandle Tracer::reserveBuffer() {
+  auto buffer = std::make_shared<ThreadBuffer>();
+  buffer->events.resize(BUFFER_CAPACITY);
+
+  std::lock_guard<std::mutex> lock(registryMutex_);
+  buffers_.push_back(buffer);
+  return buffer;
+}
+
+Tracer::BufferHandle& Tracer::currentBuffer_() {
+  thread_local BufferHandle buffer;
+  return buffer;
+}
+
+Tracer::ThreadBuffer& Tracer::threadBuffer_() {
+  BufferHandle& buffer = currentBuffer_();
+  if (buffer) {
+    return *buffer;
+  }
+
+  buffer = std::make_shared<ThreadBuffer>();
+  buffer->events.resize(BUFFER_CAPACITY);
+  buffer->threadId.store(syscall(SYS_gettid), std::memory_order_relaxed);
+  buffer->owned.store(true, std::memory_order_relaxed);
+
+  std::lock_guard<std::mutex> lock(registryMutex_);
+  buffers_.push_back(buffer);
+  return *buffer;
+}
+
+void Tracer::record(const TraceEvent& event) {
+  ThreadBuffer& buffer = threadBuffer_();
+
+  const std::uint32_t epoch = epoch_.load(std::memory_order_acquire);
+  if (buffer.epoch.load(std::memory_order_relaxed) != epoch) {
+    buffer.size.store(0, std::memory_order_relaxed);
+    buffer.dropped.store(0, std::memory_order_relaxed);
+    buffer.epoch.store(epoch, std::memory_order_release);
+  }
+
+  const std::size_t index = buffer.size.load(std::memory_order_relaxed);
+  if (index >= buffer.events.size()) {
+    buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  buffer.events[index] = event;
+  buffer.size.store(index + 1, std::memory_order_release);
+}
+
+void Tracer::setThreadName(const char* name, const BufferHandle& buffer) {
+  // The registry already owns a reserved buffer, claiming it only copies the handle. A buffer replaced here stays in
+  // the registry until the next recording, so it is not released from the calling thread.
+  BufferHandle& current = currentBuffer_();
+  bool owned = false;
+  if (buffer && current != buffer && buffer->owned.compare_exchange_strong(owned, true, std::memory_order_acq_rel)) {
+    buffer->threadId.store(syscall(SYS_gettid), std::memory_order_relaxed);
+    current = buffer;
+  }
+  threadBuffer_().name.store(name, std::memory_order_release);
+}
+
+std::size_t Tracer::writeChromeTrace(std::ostream& stream) const {
+  const long processId = static_cast<long>(getpid());
+  const std::uint32_t epoch = epoch_.load(std::memory_order_acquire);
+  std::size_t nbEvents = 0;
+  bool first = true;
+
+  auto separator = [&]() {
+    stream << (first ? "\n" : ",\n");
+    first = false;
+  };
+
+  stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  stream << std::fixed << std::setprecision(3);
+
+  std::lock_guard<std::mutex> lock(registryMutex_);
+  for (const std::shared_ptr<ThreadBuffer>& buffer : buffers_) {
+    if (!buffer->owned.load(std::memory_order_acquire)) {
+      continue;
+    }
+    const long threadId = buffer->threadId.load(std::memory_order_relaxed);
+
+    const char* name = buffer->name.load(std::memory_order_acquire);
+    if (name != nullptr) {
+      separator();
+      stream << "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":" << processId << ",\"tid\":" << threadId
+             << ",\"args\":{\"name\":";
+      writeEscaped(stream, name);
+      stream << "}}";
+    }
+
+    if (buffer->epoch.load(std::memory_order_acquire) != epoch) {
+      continue;
+    }
+
+    // Complete events, in microseconds
+    const std::size_t size = buffer->size.load(std::memory_order_acquire);
+    for (std::size_t i = 0; i < size; ++i) {
+      const TraceEvent& event = buffer->events[i];
+      separator();
+      stream << "{\"ph\":\"X\",\"cat\":";
+      writeEscaped(stream, event.category);
+      stream << ",\"name\":";
+      writeEscaped(stream, event.name);
+      stream << ",\"ts\":" << event.start * 1e-3 << ",\"dur\":" << event.duration * 1e-3 << ",\"pid\":" << processId
+             << ",\"tid\":" << threadId << "}";
+    }
+    nbEvents += size;
+  }
+
+  stream << "\n]}\n";
+  return nbEvents;
+}
+
+bool Tracer::writeChromeTrace(const std::string& path) const {
+  std::ofstream file(path);
+  if (!file) {
+    return false;
+  }
+  writeChromeTrace(file);
+  return static_cast<bool>(file);
+}
+
+std::uint64_t Tracer::getNbDropped() const {
+  const std::uint32_t epoch = epoch_.load(std::memory_order_acquire);
+  std::uint64_t dropped = 0;
+
+  std::lock_guard<std::mutex> lock(registryMutex_);
+  for (const std::shared_ptr<ThreadBuffer>& buffer : buffers_) {
+    if (buffer->epoch.load(std::memory_order_acquire) == epoch) {
+      dropped += buffer->dropped.load(std::memory_order_relaxed);
+    }
+  }
+  return dropped;
+}
+
+} // namespace wp5_common
@@ -0,0 +1,100 @@
+/**
+ * @file CartesianPathController.h
+ * @brief ros_control controller following a Cartesian path with online offset corrections.
+ *
+ * The path is received outside of the control loop, where its spline coefficients are computed, and handed over
+ * through a realtime buffer. The update only evaluates the spline, adds the latest correction and runs a damped
+ * differential IK on the generated kinematics of the robot, all on fixed-size types: nothing is allocated nor locked
+ * in the control loop, so a correction is applied within one control cycle.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <controller_interface/controller.h>
+#include <hardware_interface/joint_command_interface.h>
+#include <realtime_tools/realtime_buffer.h>
+#include <realtime_tools/realtime_publisher.h>
+#include <ros/ros.h>
+#include <trajectory_msgs/MultiDOFJointTrajectory.h>
+#include <wp5_common/Metrics.h>
+#include <wp5_common/Tracing.h>
+#include <wp5_msgs/TrajectoryClock.h>
+
+#include <Eigen/Core>
+#include <array>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "wp5_controllers/CartesianSpline.h"
+#include "wp5_controllers/PathCorrectionBuffer.h"
+#include "wp5_kinematics/KinematicsTypes.h"
+
+namespace wp5_controllers {
+
+/**
+ * @tparam Kinematics Generated kinematics of the robot, see wp5_kinematics.
+ */
+template <typename Kinematics>
+class CartesianPathController : public controller_interface::Controller<hardware_interface::PositionJointInterface> {
+public:
+  static constexpr int NB_JOINTS = Kinematics::NB_JOINTS;
+  using JointVector = Eigen::Matrix<double, NB_JOINTS, 1>;
+
+  bool init(hardware_interface::PositionJointInterface* hw,
+            ros::NodeHandle& rootNh,
+            ros::NodeHandle& controllerNh) override;
+  void starting(const ros::Time& time) override;
+  void update(const ros::Time& time, const ros::Duration& period) override;
+
+private:
+  using PathPtr = std::shared_ptr<const CartesianSpline>;
+
+  void pathCallback_(const trajectory_msgs::MultiDOFJointTrajectoryConstPtr& msg);
+  void solveIk_(const Eigen::Vector3d& position, const Eigen::Quaterniond& orientation, double period);
+
+  std::vector<hardware_interface::JointHandle> joints_;
+  JointVector lowerLimits_;
+  JointVector upperLimits_;
+  double maxJointVelocity_ = 1.0;
+  double damping_ = 1e-3;
+  int ikIterations_ = 2;
+
+  // Non real-time side: paths stay alive until the control loop moved past them
+  std::mutex pathMutex_;
+  std::deque<PathPtr> retiredPaths_;
+  std::uint64_t nextGeneration_ = 1;
+  realtime_tools::RealtimeBuffer<PathPtr> pathBuffer_;
+  std::atomic<std::uint64_t> activeGeneration_{0};
+  ros::Subscriber pathSub_;
+
+  PathCorrectionBuffer corrections_;
+
+  // Progress along the path, process events are synchronized on it
+  std::unique_ptr<realtime_tools::RealtimePublisher<wp5_msgs::TrajectoryClock>> clockPublisher_;
+
+  // Updated from the control loop, reported outside of it
+  wp5_common::MetricsRegistry metrics_;
+  wp5_common::LoopMetric* updateLoop_ = nullptr;
+  wp5_common::Counter* skippedClocks_ = nullptr;
+  wp5_common::Gauge* retiredPathsSize_ = nullptr;
+  wp5_common::Tracer::BufferHandle traceBuffer_; // Claimed by the control thread in starting
+
+  // Real-time side
+  const CartesianSpline* path_ = nullptr;
+  std::uint64_t ignoredGeneration_ = 0;
+  double pathTime_ = 0.0;
+  std::size_t segmentHint_ = 0;
+  Eigen::Vector3d lateralAxis_ = Eigen::Vector3d::UnitY();
+  JointVector command_;
+  std::array<double, NB_JOINTS> q_;
+  wp5_kinematics::Pose<double> pose_;
+  wp5_kinematics::Jacobian<double, NB_JOINTS> jacobian_;
+};
+
+} // namespace wp5_controllers
@@ -0,0 +1,57 @@
+/**
+ * @file CartesianSpline.h
+ * @brief Cartesian path with precomputed spline coefficients, evaluated without allocation.
+ *
+ * Positions are interpolated with a clamped cubic spline (at rest on both ends), orientations with a slerp between the
+ * waypoints. Coefficients are computed once when the path is received, outside of the control loop.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+#include <Eigen/StdVector>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace wp5_controllers {
+
+class CartesianSpline {
+public:
+  /**
+   * @param times Strictly increasing time of each waypoint [s], starting at 0.
+   * @param positions Waypoint positions.
+   * @param orientations Waypoint orientations.
+   * @param generation Identifier of the path, increasing with each new path.
+   */
+  CartesianSpline(const std::vector<double>& times,
+                  const std::vector<Eigen::Vector3d>& positions,
+                  const std::vector<Eigen::Quaterniond, Eigen::aligned_allocator<Eigen::Quaterniond>>& orientations,
+                  std::uint64_t generation);
+
+  double duration() const { return times_.back(); }
+  std::uint64_t generation() const { return generation_; }
+
+  /**
+   * @brief Evaluate the path at time t, clamped to [0, duration].
+   *
+   * @param hint Segment of the previous evaluation, updated, makes the lookup constant time along the path.
+   */
+  void evaluate(double t,
+                std::size_t& hint,
+                Eigen::Vector3d& position,
+                Eigen::Vector3d& velocity,
+                Eigen::Quaterniond& orientation) const;
+
+private:
+  std::vector<double> times_;
+  std::vector<Eigen::Matrix<double, 3, 4>, Eigen::aligned_allocator<Eigen::Matrix<double, 3, 4>>> coeffs_;
+  std::vector<Eigen::Quaterniond, Eigen::aligned_allocator<Eigen::Quaterniond>> orientations_;
+  std::uint64_t generation_;
+};
+
+} // namespace wp5_controllers
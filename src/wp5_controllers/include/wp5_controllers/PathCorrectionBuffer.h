@@ -0,0 +1,110 @@
+/**
+ * @file PathCorrectionBuffer.h
+ * @brief Hand-over of online path corrections to the real-time control loop.
+ *
+ * Corrections are received on a tcp_nodelay subscription and stored in a realtime buffer. The control loop reads the
+ * latest one without locking nor allocating, and moves the applied offset toward it with a bounded rate, so a new
+ * measurement is acted upon within the next control cycle.
+ *
+ * The scanner is mounted on the torch, so each measurement is the remaining error of the already corrected torch. A new
+ * measurement sets the target to the offset applied at its reception plus this error, which puts the target on the bead
+ * in the frame of the path. Applied as an absolute offset instead, the torch would settle halfway to the bead.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <realtime_tools/realtime_buffer.h>
+#include <ros/ros.h>
+#include <wp5_msgs/PathCorrection.h>
+
+#include <algorithm>
+#include <string>
+
+namespace wp5_controllers {
+
+class PathCorrectionBuffer {
+public:
+  struct Parameters {
+    double timeout = 0.2;     // Older corrections are ignored, the applied offset is held [s]
+    double maxOffset = 5e-3;  // [m]
+    double maxRate = 0.02;    // Maximum change of the applied offset [m/s]
+    double minQuality = 0.2;  // Measurements below this confidence are dropped
+  };
+
+  struct Correction {
+    ros::Time stamp;
+    double lateral = 0.0;
+    double vertical = 0.0;
+  };
+
+  /**
+   * @brief Non real-time initialization, from the controller init.
+   */
+  void init(ros::NodeHandle& nh, const std::string& topic, const Parameters& params) {
+    params_ = params;
+    buffer_.initRT(Correction());
+    subscriber_ = nh.subscribe(topic, 1, &PathCorrectionBuffer::callback_, this, ros::TransportHints().tcpNoDelay());
+  }
+
+  /**
+   * @brief Real-time, reset the applied offset when starting a new path.
+   */
+  void reset() {
+    lateral_ = 0.0;
+    vertical_ = 0.0;
+    targetLateral_ = 0.0;
+    targetVertical_ = 0.0;
+  }
+
+  /**
+   * @brief Real-time, advance the applied offset toward the latest correction.
+   */
+  void update(const ros::Time& time, const ros::Duration& period, double& lateral, double& vertical) {
+    const Correction& target = *buffer_.readFromRT();
+
+    if (!target.stamp.isZero() && (time - target.stamp).toSec() < params_.timeout) {
+      // Each measurement taken once, relative to the offset applied when it is received
+      if (target.stamp != lastStamp_) {
+        lastStamp_ = target.stamp;
+        targetLateral_ = std::clamp(lateral_ + target.lateral, -params_.maxOffset, params_.maxOffset);
+        targetVertical_ = std::clamp(vertical_ + target.vertical, -params_.maxOffset, params_.maxOffset);
+      }
+
+      const double maxStep = params_.maxRate * period.toSec();
+      lateral_ += std::clamp(targetLateral_ - lateral_, -maxStep, maxStep);
+      vertical_ += std::clamp(targetVertical_ - vertical_, -maxStep, maxStep);
+    }
+
+    lateral = lateral_;
+    vertical = vertical_;
+  }
+
+private:
+  void callback_(const wp5_msgs::PathCorrectionConstPtr& msg) {
+    if (msg->quality < params_.minQuality) {
+      return;
+    }
+
+    Correction correction;
+    correction.stamp = msg->header.stamp.isZero() ? ros::Time::now() : msg->header.stamp;
+    correction.lateral = msg->lateral;
+    correction.vertical = msg->vertical;
+    buffer_.writeFromNonRT(correction);
+  }
+
+  Parameters params_;
+  realtime_tools::RealtimeBuffer<Correction> buffer_;
+  ros::Subscriber subscriber_;
+
+  // Real-time side only
+  ros::Time lastStamp_;
+  double lateral_ = 0.0;
+  double vertical_ = 0.0;
+  double targetLateral_ = 0.0; // In the frame of the path
+  double targetVertical_ = 0.0;
+};
+
+} // namespace wp5_controllers
@@ -0,0 +1,227 @@
+/**
+ * @file CartesianPathController.cpp
+ * @brief ros_control controller following a Cartesian path with online offset corrections.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include "wp5_controllers/CartesianPathController.h"
+
+#include <pluginlib/class_list_macros.h>
+#include <wp5_common/TraceRecorder.h>
+#include <wp5_common/Tracing.h>
+
+#include <Eigen/Cholesky>
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+#include "wp5_kinematics/generated/Ur5Kinematics.h"
+
+namespace wp5_controllers {
+
+template <typename Kinematics>
+bool CartesianPathController<Kinematics>::init(hardware_interface::PositionJointInterface* hw,
+                                               ros::NodeHandle& rootNh,
+                                               ros::NodeHandle& controllerNh) {
+  std::vector<std::string> jointNames(Kinematics::JOINT_NAMES.begin(), Kinematics::JOINT_NAMES.end());
+  controllerNh.getParam("joints", jointNames);
+  if (jointNames.size() != static_cast<std::size_t>(NB_JOINTS)) {
+    ROS_ERROR_STREAM("[CartesianPathController] - Expected " << NB_JOINTS << " joints, got " << jointNames.size()
+                                                             << ".");
+    return false;
+  }
+
+  for (const std::string& name : jointNames) {
+    try {
+      joints_.push_back(hw->getHandle(name));
+    } catch (const hardware_interface::HardwareInterfaceException& e) {
+      ROS_ERROR_STREAM("[CartesianPathController] - " << e.what());
+      return false;
+    }
+  }
+
+  lowerLimits_ = Eigen::Map<const JointVector>(Kinematics::LOWER_LIMITS.data());
+  upperLimits_ = Eigen::Map<const JointVector>(Kinematics::UPPER_LIMITS.data());
+  maxJointVelocity_ = controllerNh.param("max_joint_velocity", maxJointVelocity_);
+  damping_ = controllerNh.param("damping", damping_);
+  ikIterations_ = std::max(1, controllerNh.param("ik_iterations", ikIterations_));
+
+  PathCorrectionBuffer::Parameters correctionParams;
+  correctionParams.timeout = controllerNh.param("corrections/timeout", correctionParams.timeout);
+  correctionParams.maxOffset = controllerNh.param("corrections/max_offset", correctionParams.maxOffset);
+  correctionParams.maxRate = controllerNh.param("corrections/max_rate", correctionParams.maxRate);
+  correctionParams.minQuality = controllerNh.param("corrections/min_quality", correctionParams.minQuality);
+  corrections_.init(
+      rootNh, controllerNh.param<std::string>("corrections/topic", "path_correction"), correctionParams);
+
+  clockPublisher_ = std::make_unique<realtime_tools::RealtimePublisher<wp5_msgs::TrajectoryClock>>(
+      controllerNh, "trajectory_clock", 1);
+
+  updateLoop_ = &metrics_.loop("update", controllerNh.param("diagnostics/nominal_rate", 0.0));
+  skippedClocks_ = &metrics_.drops("trajectory clocks");
+  retiredPathsSize_ = &metrics_.gauge("retired paths");
+  metrics_.advertise(rootNh, controllerNh, controllerNh.getNamespace(), "Cartesian path controller");
+
+  pathBuffer_.initRT(PathPtr());
+  pathSub_ = controllerNh.subscribe("path", 1, &CartesianPathController::pathCallback_, this);
+
+  // Trace buffer of the control thread, allocated here rather than from the control loop
+  WP5_TRACE_RESERVE(traceBuffer_);
+  wp5_common::TraceRecorder::attach(rootNh);
+  return true;
+}
+
+template <typename Kinematics>
+void CartesianPathController<Kinematics>::starting(const ros::Time& /*time*/) {
+  // Claims the trace buffer reserved in init, without lock nor allocation
+  WP5_TRACE_THREAD("controller", traceBuffer_);
+
+  for (int i = 0; i < NB_JOINTS; ++i) {
+    command_[i] = joints_[i].getPosition();
+  }
+
+  // A path received before this start is stale, wait for the next one
+  const PathPtr* latest = pathBuffer_.readFromRT();
+  ignoredGeneration_ = (latest && *latest) ? (*latest)->generation() : 0;
+  path_ = nullptr;
+  corrections_.reset();
+}
+
+template <typename Kinematics>
+void CartesianPathController<Kinematics>::update(const ros::Time& time, const ros::Duration& period) {
+  WP5_TRACE_SCOPE("executor", "update");
+  updateLoop_->tick();
+
+  const PathPtr* latest = pathBuffer_.readFromRT();
+  if (latest && *latest) {
+    const std::uint64_t generation = (*latest)->generation();
+    if (generation > ignoredGeneration_ && (!path_ || generation > path_->generation())) {
+      path_ = latest->get();
+      pathTime_ = 0.0;
+      segmentHint_ = 0;
+      corrections_.reset();
+      activeGeneration_.store(generation);
+    }
+  }
+
+  if (path_) {
+    pathTime_ += period.toSec();
+
+    Eigen::Vector3d position, velocity;
+    Eigen::Quaterniond orientation;
+    path_->evaluate(pathTime_, segmentHint_, position, velocity, orientation);
+
+    // Corrections are horizontal normal to the path and vertical, the lateral axis is held when the path stops
+    const Eigen::Vector3d lateral = Eigen::Vector3d::UnitZ().cross(velocity);
+    if (lateral.squaredNorm() > 1e-12) {
+      lateralAxis_ = lateral.normalized();
+    }
+
+    double lateralOffset = 0.0, verticalOffset = 0.0;
+    corrections_.update(time, period, lateralOffset, verticalOffset);
+    position += lateralOffset * lateralAxis_ + verticalOffset * Eigen::Vector3d::UnitZ();
+
+    solveIk_(position, orientation, period.toSec());
+
+    if (clockPublisher_->trylock()) {
+      clockPublisher_->msg_.header.stamp = time;
+      clockPublisher_->msg_.generation = path_->generation();
+      clockPublisher_->msg_.path_time = pathTime_;
+      clockPublisher_->msg_.duration = path_->duration();
+      clockPublisher_->unlockAndPublish();
+    } else {
+      skippedClocks_->add();
+    }
+  }
+
+  for (int i = 0; i < NB_JOINTS; ++i) {
+    joints_[i].setCommand(command_[i]);
+  }
+}
+
+template <typename Kinematics>
+void CartesianPathController<Kinematics>::solveIk_(const Eigen::Vector3d& position,
+                                                   const Eigen::Quaterniond& orientation,
+                                                   double period) {
+  const JointVector previous = command_;
+  const Eigen::Matrix3d targetRotation = orientation.toRotationMatrix();
+
+  for (int iter = 0; iter < ikIterations_; ++iter) {
+    for (int i = 0; i < NB_JOINTS; ++i) {
+      q_[i] = command_[i];
+    }
+    Kinematics::jacobian(q_, pose_, jacobian_);
+
+    const Eigen::Map<const Eigen::Matrix<double, 3, 3, Eigen::RowMajor>> rotation(pose_.rotation.data());
+    const Eigen::Map<const Eigen::Vector3d> translation(pose_.translation.data());
+    const Eigen::AngleAxisd rotationError(targetRotation * rotation.transpose());
+
+    Eigen::Matrix<double, 6, 1> error;
+    error.head<3>() = position - translation;
+    error.tail<3>() = rotationError.angle() * rotationError.axis();
+
+    const Eigen::Matrix<double, 6, NB_JOINTS> jac = wp5_kinematics::toMatrix(jacobian_);
+    Eigen::Matrix<double, 6, 6> jjt = jac * jac.transpose();
+    jjt.diagonal().array() += damping_ * damping_;
+
+    command_ += jac.transpose() * jjt.ldlt().solve(error);
+  }
+
+  const double maxStep = maxJointVelocity_ * period;
+  command_ = (previous + (command_ - previous).cwiseMax(-maxStep).cwiseMin(maxStep))
+                 .cwiseMax(lowerLimits_)
+                 .cwiseMin(upperLimits_);
+}
+
+template <typename Kinematics>
+void CartesianPathController<Kinematics>::pathCallback_(const trajectory_msgs::MultiDOFJointTrajectoryConstPtr& msg) {
+  std::vector<double> times;
+  std::vector<Eigen::Vector3d> positions;
+  std::vector<Eigen::Quaterniond, Eigen::aligned_allocator<Eigen::Quaterniond>> orientations;
+
+  for (const trajectory_msgs::MultiDOFJointTrajectoryPoint& point : msg->points) {
+    if (point.transforms.empty()) {
+      continue;
+    }
+
+    const geometry_msgs::Transform& tf = point.transforms.front();
+    times.push_back(point.time_from_start.toSec());
+    positions.emplace_back(tf.translation.x, tf.translation.y, tf.translation.z);
+    orientations.emplace_back(tf.rotation.w, tf.rotation.x, tf.rotation.y, tf.rotation.z);
+    orientations.back().normalize();
+  }
+
+  // The path starts when the control loop picks it up
+  if (!times.empty()) {
+    const double start = times.front();
+    std::for_each(times.begin(), times.end(), [start](double& t) { t -= start; });
+  }
+
+  std::lock_guard<std::mutex> lock(pathMutex_);
+  PathPtr path;
+  try {
+    path = std::make_shared<const CartesianSpline>(times, positions, orientations, nextGeneration_++);
+  } catch (const std::invalid_argument& e) {
+    ROS_ERROR_STREAM("[CartesianPathController] - Path rejected: " << e.what());
+    return;
+  }
+
+  pathBuffer_.writeFromNonRT(path);
+
+  // Release the paths the control loop moved past, outside of the control loop
+  retiredPaths_.push_back(path);
+  const std::uint64_t active = activeGeneration_.load();
+  while (!retiredPaths_.empty() && retiredPaths_.front()->generation() < active) {
+    retiredPaths_.pop_front();
+  }
+  retiredPathsSize_->set(static_cast<std::int64_t>(retiredPaths_.size()));
+}
+
+using Ur5CartesianPathController = CartesianPathController<wp5_kinematics::Ur5Kinematics>;
+template class CartesianPathController<wp5_kinematics::Ur5Kinematics>;
+
+} // namespace wp5_controllers
+
+PLUGINLIB_EXPORT_CLASS(wp5_controllers::Ur5CartesianPathController, controller_interface::ControllerBase)
@@ -0,0 +1,111 @@
+/**
+ * @file CartesianSpline.cpp
+ * @brief Cartesian path with precomputed spline coefficients, evaluated without allocation.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include "wp5_controllers/CartesianSpline.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace wp5_controllers {
+
+CartesianSpline::CartesianSpline(
+    const std::vector<double>& times,
+    const std::vector<Eigen::Vector3d>& positions,
+    const std::vector<Eigen::Quaterniond, Eigen::aligned_allocator<Eigen::Quaterniond>>& orientations,
+    std::uint64_t generation) :
+    times_(times), orientations_(orientations), generation_(generation) {
+  const std::size_t nbPoints = times_.size();
+  if (nbPoints < 2 || positions.size() != nbPoints || orientations_.size() != nbPoints) {
+    throw std::invalid_argument("[CartesianSpline] - At least two waypoints with position and orientation needed.");
+  }
+  for (std::size_t i = 1; i < nbPoints; ++i) {
+    if (times_[i] <= times_[i - 1]) {
+      throw std::invalid_argument("[CartesianSpline] - Waypoint times must be strictly increasing.");
+    }
+  }
+
+  // Shortest slerp between consecutive waypoints
+  for (std::size_t i = 1; i < nbPoints; ++i) {
+    if (orientations_[i].dot(orientations_[i - 1]) < 0.0) {
+      orientations_[i].coeffs() = -orientations_[i].coeffs();
+    }
+  }
+
+  // Clamped cubic spline, second derivatives from a tridiagonal system solved with the Thomas algorithm
+  const std::size_t nbSegments = nbPoints - 1;
+  std::vector<double> h(nbSegments);
+  for (std::size_t i = 0; i < nbSegments; ++i) {
+    h[i] = times_[i + 1] - times_[i];
+  }
+
+  std::vector<double> lower(nbPoints, 0.0), diag(nbPoints, 0.0), upper(nbPoints, 0.0);
+  std::vector<Eigen::Vector3d> rhs(nbPoints);
+
+  diag[0] = 2.0 * h[0];
+  upper[0] = h[0];
+  rhs[0] = 6.0 * (positions[1] - positions[0]) / h[0];
+
+  for (std::size_t i = 1; i < nbSegments; ++i) {
+    lower[i] = h[i - 1];
+    diag[i] = 2.0 * (h[i - 1] + h[i]);
+    upper[i] = h[i];
+    rhs[i] = 6.0 * ((positions[i + 1] - positions[i]) / h[i] - (positions[i] - positions[i - 1]) / h[i - 1]);
+  }
+
+  lower[nbSegments] = h[nbSegments - 1];
+  diag[nbSegments] = 2.0 * h[nbSegments - 1];
+  rhs[nbSegments] = -6.0 * (positions[nbSegments] - positions[nbSegments - 1]) / h[nbSegments - 1];
+
+  for (std::size_t i = 1; i < nbPoints; ++i) {
+    const double factor = lower[i] / diag[i - 1];
+    diag[i] -= factor * upper[i - 1];
+    rhs[i] -= factor * rhs[i - 1];
+  }
+
+  std::vector<Eigen::Vector3d> second(nbPoints);
+  second[nbSegments] = rhs[nbSegments] / diag[nbSegments];
+  for (std::size_t i = nbSegments; i-- > 0;) {
+    second[i] = (rhs[i] - upper[i] * second[i + 1]) / diag[i];
+  }
+
+  coeffs_.resize(nbSegments);
+  for (std::size_t i = 0; i < nbSegments; ++i) {
+    coeffs_[i].col(0) = positions[i];
+    coeffs_[i].col(1) = (positions[i + 1] - positions[i]) / h[i] - h[i] * (2.0 * second[i] + second[i + 1]) / 6.0;
+    coeffs_[i].col(2) = 0.5 * second[i];
+    coeffs_[i].col(3) = (second[i + 1] - second[i]) / (6.0 * h[i]);
+  }
+}
+
+void CartesianSpline::evaluate(double t,
+                               std::size_t& hint,
+                               Eigen::Vector3d& position,
+                               Eigen::Vector3d& velocity,
+                               Eigen::Quaterniond& orientation) const {
+  t = std::clamp(t, times_.front(), times_.back());
+
+  std::size_t segment = std::min(hint, coeffs_.size() - 1);
+  if (times_[segment] > t) {
+    segment = 0;
+  }
+  while (segment + 1 < coeffs_.size() && times_[segment + 1] <= t) {
+    ++segment;
+  }
+  hint = segment;
+
+  const double dt = t - times_[segment];
+  const Eigen::Matrix<double, 3, 4>& c = coeffs_[segment];
+
+  position = c.col(0) + dt * (c.col(1) + dt * (c.col(2) + dt * c.col(3)));
+  velocity = c.col(1) + dt * (2.0 * c.col(2) + dt * 3.0 * c.col(3));
+
+  const double ratio = dt / (times_[segment + 1] - times_[segment]);
+  orientation = orientations_[segment].slerp(ratio, orientations_[segment + 1]);
+}
+
+} // namespace wp5_controllers
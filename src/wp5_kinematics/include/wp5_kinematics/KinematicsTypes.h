@@ -0,0 +1,78 @@
+/**
+ * @file KinematicsTypes.h
+ * @brief Types shared by the generated forward kinematics and Jacobians.
+ *
+ * The generated code only uses +, -, *, sin and cos on its scalar type. Any type providing them works: double for a
+ * single configuration, or a fixed-size Eigen array to evaluate a batch of configurations at once, one per SIMD lane.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+#include <array>
+
+namespace wp5_kinematics {
+
+/**
+ * @brief Batch of configurations evaluated together, one lane per configuration.
+ */
+template <int N>
+using Batch = Eigen::Array<double, N, 1>;
+
+template <typename Scalar>
+struct ScalarTraits {
+  static Scalar constant(double value) { return Scalar(value); }
+};
+
+template <int N>
+struct ScalarTraits<Batch<N>> {
+  static Batch<N> constant(double value) { return Batch<N>::Constant(value); }
+};
+
+template <typename Scalar>
+Scalar constant(double value) {
+  return ScalarTraits<Scalar>::constant(value);
+}
+
+/**
+ * @brief Tool pose in the robot base frame, rotation stored row major.
+ */
+template <typename Scalar>
+struct Pose {
+  std::array<Scalar, 9> rotation;
+  std::array<Scalar, 3> translation;
+};
+
+/**
+ * @brief Geometric Jacobian at the tool, expressed in the robot base frame.
+ *
+ * Rows are the linear velocity (x, y, z) then the angular velocity (x, y, z).
+ */
+template <typename Scalar, int NbJoints>
+struct Jacobian {
+  std::array<std::array<Scalar, NbJoints>, 6> data;
+};
+
+inline Eigen::Isometry3d toIsometry(const Pose<double>& pose) {
+  Eigen::Isometry3d transform = Eigen::Isometry3d::Identity();
+  transform.linear() = Eigen::Map<const Eigen::Matrix<double, 3, 3, Eigen::RowMajor>>(pose.rotation.data());
+  transform.translation() = Eigen::Map<const Eigen::Vector3d>(pose.translation.data());
+  return transform;
+}
+
+template <int NbJoints>
+Eigen::Matrix<double, 6, NbJoints> toMatrix(const Jacobian<double, NbJoints>& jacobian) {
+  Eigen::Matrix<double, 6, NbJoints> matrix;
+  for (int r = 0; r < 6; ++r) {
+    for (int c = 0; c < NbJoints; ++c) {
+      matrix(r, c) = jacobian.data[r][c];
+    }
+  }
+  return matrix;
+}
+
+} // namespace wp5_kinematics
@@ -0,0 +1,221 @@
+/**
+ * @file Ur5Kinematics.h
+ * @brief Forward kinematics and Jacobian specialized for the Ur5 DH parameters.
+ *
+ * Generated by wp5_kinematics/scripts/generate_kinematics.py from config/ur5.yaml, do not edit.
+ */
+
+#pragma once
+
+#include <array>
+#include <cmath>
+
+#include "wp5_kinematics/KinematicsTypes.h"
+
+namespace wp5_kinematics {
+
+// clang-format off
+struct Ur5Kinematics {
+  static constexpr int NB_JOINTS = 6;
+  static constexpr std::array<const char*, NB_JOINTS> JOINT_NAMES = {"shoulder_pan_joint", "shoulder_lift_joint", "elbow_joint", "wrist_1_joint", "wrist_2_joint", "wrist_3_joint"};
+  static constexpr std::array<double, NB_JOINTS> LOWER_LIMITS = {-6.283185307179586, -6.283185307179586, -3.141592653589793, -6.283185307179586, -6.283185307179586, -6.283185307179586};
+  static constexpr std::array<double, NB_JOINTS> UPPER_LIMITS = {6.283185307179586, 6.283185307179586, 3.141592653589793, 6.283185307179586, 6.283185307179586, 6.283185307179586};
+
+  template <typename Scalar>
+  static void forwardKinematics(const std::array<Scalar, NB_JOINTS>& q, Pose<Scalar>& pose) {
+    using std::cos;
+    using std::sin;
+
+    const Scalar c0 = cos(q[0]);
+    const Scalar s0 = sin(q[0]);
+    const Scalar r0_12 = -c0;
+    const Scalar c1 = cos(q[1]);
+    const Scalar s1 = sin(q[1]);
+    const Scalar r1_00 = c0 * c1;
+    const Scalar r1_01 = -c0 * s1;
+    const Scalar r1_10 = c1 * s0;
+    const Scalar r1_11 = -s0 * s1;
+    const Scalar p1_0 = -0.425 * c0 * c1;
+    const Scalar p1_1 = -0.425 * c1 * s0;
+    const Scalar p1_2 = -0.425 * s1 + 0.089159;
+    const Scalar c2 = cos(q[2]);
+    const Scalar s2 = sin(q[2]);
+    const Scalar r2_00 = c2 * r1_00 + r1_01 * s2;
+    const Scalar r2_01 = c2 * r1_01 - r1_00 * s2;
+    const Scalar r2_10 = c2 * r1_10 + r1_11 * s2;
+    const Scalar r2_11 = c2 * r1_11 - r1_10 * s2;
+    const Scalar r2_20 = c1 * s2 + c2 * s1;
+    const Scalar r2_21 = c1 * c2 - s1 * s2;
+    const Scalar p2_0 = -0.39225 * c2 * r1_00 + p1_0 - 0.39225 * r1_01 * s2;
+    const Scalar p2_1 = -0.39225 * c2 * r1_10 + p1_1 - 0.39225 * r1_11 * s2;
+    const Scalar p2_2 = -0.39225 * c1 * s2 - 0.39225 * c2 * s1 + p1_2;
+    const Scalar c3 = cos(q[3]);
+    const Scalar s3 = sin(q[3]);
+    const Scalar r3_00 = c3 * r2_00 + r2_01 * s3;
+    const Scalar r3_02 = -c3 * r2_01 + r2_00 * s3;
+    const Scalar r3_10 = c3 * r2_10 + r2_11 * s3;
+    const Scalar r3_12 = -c3 * r2_11 + r2_10 * s3;
+    const Scalar r3_20 = c3 * r2_20 + r2_21 * s3;
+    const Scalar r3_22 = -c3 * r2_21 + r2_20 * s3;
+    const Scalar p3_0 = p2_0 + 0.10915 * s0;
+    const Scalar p3_1 = p2_1 + 0.10915 * r0_12;
+    const Scalar c4 = cos(q[4]);
+    const Scalar s4 = sin(q[4]);
+    const Scalar r4_00 = c4 * r3_00 + s0 * s4;
+    const Scalar r4_01 = -r3_02;
+    const Scalar r4_02 = c4 * s0 - r3_00 * s4;
+    const Scalar r4_10 = c4 * r3_10 + r0_12 * s4;
+    const Scalar r4_11 = -r3_12;
+    const Scalar r4_12 = c4 * r0_12 - r3_10 * s4;
+    const Scalar r4_20 = c4 * r3_20;
+    const Scalar r4_21 = -r3_22;
+    const Scalar r4_22 = -r3_20 * s4;
+    const Scalar p4_0 = p3_0 + 0.09465 * r3_02;
+    const Scalar p4_1 = p3_1 + 0.09465 * r3_12;
+    const Scalar p4_2 = p2_2 + 0.09465 * r3_22;
+    const Scalar c5 = cos(q[5]);
+    const Scalar s5 = sin(q[5]);
+    const Scalar r5_00 = c5 * r4_00 + r4_01 * s5;
+    const Scalar r5_01 = c5 * r4_01 - r4_00 * s5;
+    const Scalar r5_10 = c5 * r4_10 + r4_11 * s5;
+    const Scalar r5_11 = c5 * r4_11 - r4_10 * s5;
+    const Scalar r5_20 = c5 * r4_20 + r4_21 * s5;
+    const Scalar r5_21 = c5 * r4_21 - r4_20 * s5;
+    const Scalar p5_0 = p4_0 + 0.0823 * r4_02;
+    const Scalar p5_1 = p4_1 + 0.0823 * r4_12;
+    const Scalar p5_2 = p4_2 + 0.0823 * r4_22;
+    pose.rotation[0] = r5_00;
+    pose.rotation[1] = r5_01;
+    pose.rotation[2] = r4_02;
+    pose.rotation[3] = r5_10;
+    pose.rotation[4] = r5_11;
+    pose.rotation[5] = r4_12;
+    pose.rotation[6] = r5_20;
+    pose.rotation[7] = r5_21;
+    pose.rotation[8] = r4_22;
+    pose.translation[0] = p5_0;
+    pose.translation[1] = p5_1;
+    pose.translation[2] = p5_2;
+  }
+
+  /**
+   * @brief Tool pose and geometric Jacobian, sharing the chain evaluation.
+   */
+  template <typename Scalar>
+  static void jacobian(const std::array<Scalar, NB_JOINTS>& q,
+                       Pose<Scalar>& pose,
+                       Jacobian<Scalar, NB_JOINTS>& jac) {
+    using std::cos;
+    using std::sin;
+
+    const Scalar c0 = cos(q[0]);
+    const Scalar s0 = sin(q[0]);
+    const Scalar r0_12 = -c0;
+    const Scalar c1 = cos(q[1]);
+    const Scalar s1 = sin(q[1]);
+    const Scalar r1_00 = c0 * c1;
+    const Scalar r1_01 = -c0 * s1;
+    const Scalar r1_10 = c1 * s0;
+    const Scalar r1_11 = -s0 * s1;
+    const Scalar p1_0 = -0.425 * c0 * c1;
+    const Scalar p1_1 = -0.425 * c1 * s0;
+    const Scalar p1_2 = -0.425 * s1 + 0.089159;
+    const Scalar c2 = cos(q[2]);
+    const Scalar s2 = sin(q[2]);
+    const Scalar r2_00 = c2 * r1_00 + r1_01 * s2;
+    const Scalar r2_01 = c2 * r1_01 - r1_00 * s2;
+    const Scalar r2_10 = c2 * r1_10 + r1_11 * s2;
+    const Scalar r2_11 = c2 * r1_11 - r1_10 * s2;
+    const Scalar r2_20 = c1 * s2 + c2 * s1;
+    const Scalar r2_21 = c1 * c2 - s1 * s2;
+    const Scalar p2_0 = -0.39225 * c2 * r1_00 + p1_0 - 0.39225 * r1_01 * s2;
+    const Scalar p2_1 = -0.39225 * c2 * r1_10 + p1_1 - 0.39225 * r1_11 * s2;
+    const Scalar p2_2 = -0.39225 * c1 * s2 - 0.39225 * c2 * s1 + p1_2;
+    const Scalar c3 = cos(q[3]);
+    const Scalar s3 = sin(q[3]);
+    const Scalar r3_00 = c3 * r2_00 + r2_01 * s3;
+    const Scalar r3_02 = -c3 * r2_01 + r2_00 * s3;
+    const Scalar r3_10 = c3 * r2_10 + r2_11 * s3;
+    const Scalar r3_12 = -c3 * r2_11 + r2_10 * s3;
+    const Scalar r3_20 = c3 * r2_20 + r2_21 * s3;
+    const Scalar r3_22 = -c3 * r2_21 + r2_20 * s3;
+    const Scalar p3_0 = p2_0 + 0.10915 * s0;
+    const Scalar p3_1 = p2_1 + 0.10915 * r0_12;
+    const Scalar c4 = cos(q[4]);
+    const Scalar s4 = sin(q[4]);
+    const Scalar r4_00 = c4 * r3_00 + s0 * s4;
+    const Scalar r4_01 = -r3_02;
+    const Scalar r4_02 = c4 * s0 - r3_00 * s4;
+    const Scalar r4_10 = c4 * r3_10 + r0_12 * s4;
+    const Scalar r4_11 = -r3_12;
+    const Scalar r4_12 = c4 * r0_12 - r3_10 * s4;
+    const Scalar r4_20 = c4 * r3_20;
+    const Scalar r4_21 = -r3_22;
+    const Scalar r4_22 = -r3_20 * s4;
+    const Scalar p4_0 = p3_0 + 0.09465 * r3_02;
+    const Scalar p4_1 = p3_1 + 0.09465 * r3_12;
+    const Scalar p4_2 = p2_2 + 0.09465 * r3_22;
+    const Scalar c5 = cos(q[5]);
+    const Scalar s5 = sin(q[5]);
+    const Scalar r5_00 = c5 * r4_00 + r4_01 * s5;
+    const Scalar r5_01 = c5 * r4_01 - r4_00 * s5;
+    const Scalar r5_10 = c5 * r4_10 + r4_11 * s5;
+    const Scalar r5_11 = c5 * r4_11 - r4_10 * s5;
+    const Scalar r5_20 = c5 * r4_20 + r4_21 * s5;
+    const Scalar r5_21 = c5 * r4_21 - r4_20 * s5;
+    const Scalar p5_0 = p4_0 + 0.0823 * r4_02;
+    const Scalar p5_1 = p4_1 + 0.0823 * r4_12;
+    const Scalar p5_2 = p4_2 + 0.0823 * r4_22;
+    pose.rotation[0] = r5_00;
+    pose.rotation[1] = r5_01;
+    pose.rotation[2] = r4_02;
+    pose.rotation[3] = r5_10;
+    pose.rotation[4] = r5_11;
+    pose.rotation[5] = r4_12;
+    pose.rotation[6] = r5_20;
+    pose.rotation[7] = r5_21;
+    pose.rotation[8] = r4_22;
+    pose.translation[0] = p5_0;
+    pose.translation[1] = p5_1;
+    pose.translation[2] = p5_2;
+    jac.data[0][0] = -p5_1;
+    jac.data[3][0] = constant<Scalar>(0.0);
+    jac.data[1][0] = p5_0;
+    jac.data[4][0] = constant<Scalar>(0.0);
+    jac.data[2][0] = constant<Scalar>(0.0);
+    jac.data[5][0] = constant<Scalar>(1.0);
+    jac.data[0][1] = p5_2 * r0_12 - 0.089159 * r0_12;
+    jac.data[3][1] = s0;
+    jac.data[1][1] = -p5_2 * s0 + 0.089159 * s0;
+    jac.data[4][1] = r0_12;
+    jac.data[2][1] = -p5_0 * r0_12 + p5_1 * s0;
+    jac.data[5][1] = constant<Scalar>(0.0);
+    jac.data[0][2] = -p1_2 * r0_12 + p5_2 * r0_12;
+    jac.data[3][2] = s0;
+    jac.data[1][2] = p1_2 * s0 - p5_2 * s0;
+    jac.data[4][2] = r0_12;
+    jac.data[2][2] = p1_0 * r0_12 - p1_1 * s0 - p5_0 * r0_12 + p5_1 * s0;
+    jac.data[5][2] = constant<Scalar>(0.0);
+    jac.data[0][3] = -p2_2 * r0_12 + p5_2 * r0_12;
+    jac.data[3][3] = s0;
+    jac.data[1][3] = p2_2 * s0 - p5_2 * s0;
+    jac.data[4][3] = r0_12;
+    jac.data[2][3] = p2_0 * r0_12 - p2_1 * s0 - p5_0 * r0_12 + p5_1 * s0;
+    jac.data[5][3] = constant<Scalar>(0.0);
+    jac.data[0][4] = -p2_2 * r3_12 + p3_1 * r3_22 - p5_1 * r3_22 + p5_2 * r3_12;
+    jac.data[3][4] = r3_02;
+    jac.data[1][4] = p2_2 * r3_02 - p3_0 * r3_22 + p5_0 * r3_22 - p5_2 * r3_02;
+    jac.data[4][4] = r3_12;
+    jac.data[2][4] = p3_0 * r3_12 - p3_1 * r3_02 - p5_0 * r3_12 + p5_1 * r3_02;
+    jac.data[5][4] = r3_22;
+    jac.data[0][5] = p4_1 * r4_22 - p4_2 * r4_12 - p5_1 * r4_22 + p5_2 * r4_12;
+    jac.data[3][5] = r4_02;
+    jac.data[1][5] = -p4_0 * r4_22 + p4_2 * r4_02 + p5_0 * r4_22 - p5_2 * r4_02;
+    jac.data[4][5] = r4_12;
+    jac.data[2][5] = p4_0 * r4_12 - p4_1 * r4_02 - p5_0 * r4_12 + p5_1 * r4_02;
+    jac.data[5][5] = r4_22;
+  }
+};
+// clang-format on
+
+} // namespace wp5_kinematics
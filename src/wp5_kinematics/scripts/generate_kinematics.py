@@ -0,0 +1,273 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+# Generate a header-only forward kinematics and Jacobian specialized for a robot described by its DH parameters.
+# Author: lmunier - <lmunier@protonmail.com>
+# Date: 2026-10-17
+#
+# The chain product is expanded symbolically at generation time: every DH constant is folded, terms multiplied by zero
+# disappear and the remaining expressions are written as plain arithmetic on a templated scalar type.
+#
+# Usage: generate_kinematics.py <robot.yaml> <output.h>
+
+import math
+import os
+import sys
+
+import yaml
+
+EPS = 1e-12
+
+
+class Expr:
+    """Polynomial in the generated variables, stored as {sorted factors: coefficient}."""
+
+    def __init__(self, terms=None):
+        self.terms = {}
+        for factors, coef in (terms or {}).items():
+            if abs(coef) > EPS:
+                self.terms[factors] = coef
+
+    @staticmethod
+    def const(value):
+        return Expr({(): snap(value)})
+
+    @staticmethod
+    def var(name):
+        return Expr({(name,): 1.0})
+
+    def is_const(self):
+        return all(not factors for factors in self.terms)
+
+    def is_var(self):
+        return len(self.terms) == 1 and all(len(f) == 1 and c == 1.0 for f, c in self.terms.items())
+
+    def __add__(self, other):
+        terms = dict(self.terms)
+        for factors, coef in other.terms.items():
+            terms[factors] = terms.get(factors, 0.0) + coef
+        return Expr(terms)
+
+    def __neg__(self):
+        return Expr({factors: -coef for factors, coef in self.terms.items()})
+
+    def __sub__(self, other):
+        return self + (-other)
+
+    def __mul__(self, other):
+        terms = {}
+        for f1, c1 in self.terms.items():
+            for f2, c2 in other.terms.items():
+                factors = tuple(sorted(f1 + f2))
+                terms[factors] = terms.get(factors, 0.0) + c1 * c2
+        return Expr(terms)
+
+    def to_cpp(self):
+        if not self.terms:
+            return "constant<Scalar>(0.0)"
+        if self.is_const():
+            return "constant<Scalar>({})".format(fmt(self.terms[()]))
+
+        # Constant term last, so the expression always starts with a Scalar
+        ordered = sorted(self.terms.items(), key=lambda item: (not item[0], item[0]))
+        code = ""
+        for i, (factors, coef) in enumerate(ordered):
+            if not factors:
+                term = fmt(abs(coef))
+            elif abs(abs(coef) - 1.0) < EPS:
+                term = " * ".join(factors)
+            else:
+                term = fmt(abs(coef)) + " * " + " * ".join(factors)
+
+            if i == 0:
+                code = ("-" if coef < 0.0 else "") + term
+            else:
+                code += (" - " if coef < 0.0 else " + ") + term
+        return code
+
+
+def snap(value):
+    for target in (0.0, 1.0, -1.0):
+        if abs(value - target) < EPS:
+            return target
+    return value
+
+
+def fmt(value):
+    return repr(float(value))
+
+
+def rpy_to_matrix(roll, pitch, yaw):
+    cr, sr = math.cos(roll), math.sin(roll)
+    cp, sp = math.cos(pitch), math.sin(pitch)
+    cy, sy = math.cos(yaw), math.sin(yaw)
+    return [
+        [cy * cp, cy * sp * sr - sy * cr, cy * sp * cr + sy * sr],
+        [sy * cp, sy * sp * sr + cy * cr, sy * sp * cr - cy * sr],
+        [-sp, cp * sr, cp * cr],
+    ]
+
+
+def const_frame(xyz_rpy):
+    rot = rpy_to_matrix(*xyz_rpy[3:])
+    return ([[Expr.const(v) for v in row] for row in rot], [Expr.const(v) for v in xyz_rpy[:3]])
+
+
+def compose(rot, pos, rot_i, pos_i):
+    new_rot = [[rot[r][0] * rot_i[0][c] + rot[r][1] * rot_i[1][c] + rot[r][2] * rot_i[2][c] for c in range(3)]
+               for r in range(3)]
+    new_pos = [pos[r] + rot[r][0] * pos_i[0] + rot[r][1] * pos_i[1] + rot[r][2] * pos_i[2] for r in range(3)]
+    return new_rot, new_pos
+
+
+class Emitter:
+
+    def __init__(self):
+        self.lines = []
+
+    def materialize(self, expr, name):
+        if expr.is_const() or expr.is_var():
+            return expr
+        self.lines.append("const Scalar {} = {};".format(name, expr.to_cpp()))
+        return Expr.var(name)
+
+
+def expand_chain(robot, emitter):
+    """Emit the chain product, return the intermediate joint axes/origins and the tool frame."""
+    rot, pos = const_frame(robot.get("base", [0.0] * 6))
+    axes, origins = [], []
+
+    for i, (a, alpha, d, offset) in enumerate(robot["dh"]):
+        angle = "q[{}]".format(i) if offset == 0.0 else "q[{}] + {}".format(i, fmt(offset))
+        emitter.lines.append("const Scalar c{0} = cos({1});".format(i, angle))
+        emitter.lines.append("const Scalar s{0} = sin({1});".format(i, angle))
+
+        # Joint i rotates about the z axis of the previous frame
+        axes.append([rot[r][2] for r in range(3)])
+        origins.append(list(pos))
+
+        c, s = Expr.var("c{}".format(i)), Expr.var("s{}".format(i))
+        ca, sa = Expr.const(math.cos(alpha)), Expr.const(math.sin(alpha))
+        rot_i = [[c, -s * ca, s * sa], [s, c * ca, -c * sa], [Expr.const(0.0), sa, ca]]
+        pos_i = [Expr.const(a) * c, Expr.const(a) * s, Expr.const(d)]
+
+        rot, pos = compose(rot, pos, rot_i, pos_i)
+        rot = [[emitter.materialize(rot[r][k], "r{}_{}{}".format(i, r, k)) for k in range(3)] for r in range(3)]
+        pos = [emitter.materialize(pos[r], "p{}_{}".format(i, r)) for r in range(3)]
+
+    rot_t, pos_t = const_frame(robot.get("tool", [0.0] * 6))
+    rot, pos = compose(rot, pos, rot_t, pos_t)
+    return axes, origins, rot, pos
+
+
+def generate(robot, source):
+    name = robot["name"]
+    nb_joints = len(robot["dh"])
+    joints = robot.get("joints", ["joint_{}".format(i + 1) for i in range(nb_joints)])
+    indent = " " * 4
+
+    fk = Emitter()
+    _, _, rot, pos = expand_chain(robot, fk)
+    fk_body = fk.lines + ["pose.rotation[{}] = {};".format(3 * r + k, rot[r][k].to_cpp()) for r in range(3)
+                          for k in range(3)]
+    fk_body += ["pose.translation[{}] = {};".format(r, pos[r].to_cpp()) for r in range(3)]
+
+    jac = Emitter()
+    axes, origins, rot, pos = expand_chain(robot, jac)
+    tool = [jac.materialize(pos[r], "pe_{}".format(r)) for r in range(3)]
+    jac_body = list(jac.lines)
+    jac_body += ["pose.rotation[{}] = {};".format(3 * r + k, rot[r][k].to_cpp()) for r in range(3) for k in range(3)]
+    jac_body += ["pose.translation[{}] = {};".format(r, tool[r].to_cpp()) for r in range(3)]
+
+    for i in range(nb_joints):
+        z = axes[i]
+        arm = [tool[r] - origins[i][r] for r in range(3)]
+        linear = [z[1] * arm[2] - z[2] * arm[1], z[2] * arm[0] - z[0] * arm[2], z[0] * arm[1] - z[1] * arm[0]]
+        for r in range(3):
+            jac_body.append("jac.data[{}][{}] = {};".format(r, i, linear[r].to_cpp()))
+            jac_body.append("jac.data[{}][{}] = {};".format(r + 3, i, z[r].to_cpp()))
+
+    def block(body):
+        return "\n".join(indent + line for line in body)
+
+    lower = robot.get("lower_limits", [-math.pi] * nb_joints)
+    upper = robot.get("upper_limits", [math.pi] * nb_joints)
+
+    return HEADER_TEMPLATE.format(
+        name=name,
+        source=source,
+        nb_joints=nb_joints,
+        joint_names=", ".join('"{}"'.format(j) for j in joints),
+        lower=", ".join(fmt(v) for v in lower),
+        upper=", ".join(fmt(v) for v in upper),
+        fk_body=block(fk_body),
+        jac_body=block(jac_body),
+    )
+
+
+HEADER_TEMPLATE = """/**
+ * @file {name}Kinematics.h
+ * @brief Forward kinematics and Jacobian specialized for the {name} DH parameters.
+ *
+ * Generated by wp5_kinematics/scripts/generate_kinematics.py from {source}, do not edit.
+ */
+
+#pragma once
+
+#include <array>
+#include <cmath>
+
+#include "wp5_kinematics/KinematicsTypes.h"
+
+namespace wp5_kinematics {{
+
+// clang-format off
+struct {name}Kinematics {{
+  static constexpr int NB_JOINTS = {nb_joints};
+  static constexpr std::array<const char*, NB_JOINTS> JOINT_NAMES = {{{joint_names}}};
+  static constexpr std::array<double, NB_JOINTS> LOWER_LIMITS = {{{lower}}};
+  static constexpr std::array<double, NB_JOINTS> UPPER_LIMITS = {{{upper}}};
+
+  template <typename Scalar>
+  static void forwardKinematics(const std::array<Scalar, NB_JOINTS>& q, Pose<Scalar>& pose) {{
+    using std::cos;
+    using std::sin;
+
+{fk_body}
+  }}
+
+  /**
+   * @brief Tool pose and geometric Jacobian, sharing the chain evaluation.
+   */
+  template <typename Scalar>
+  static void jacobian(const std::array<Scalar, NB_JOINTS>& q,
+                       Pose<Scalar>& pose,
+                       Jacobian<Scalar, NB_JOINTS>& jac) {{
+    using std::cos;
+    using std::sin;
+
+{jac_body}
+  }}
+}};
+// clang-format on
+
+}} // namespace wp5_kinematics
+"""
+
+
+def main():
+    if len(sys.argv) != 3:
+        print("Usage: {} <robot.yaml> <output.h>".format(sys.argv[0]))
+        return 1
+
+    with open(sys.argv[1], "r") as file:
+        robot = yaml.safe_load(file)
+
+    source = os.path.join("config", os.path.basename(sys.argv[1]))
+    with open(sys.argv[2], "w") as file:
+        file.write(generate(robot, source))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
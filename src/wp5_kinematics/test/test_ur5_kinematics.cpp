@@ -0,0 +1,110 @@
+/**
+ * @file test_ur5_kinematics.cpp
+ * @brief Unit tests of the generated UR5 forward kinematics and Jacobian.
+ *
+ * The reference is the plain product of the DH transforms of config/ur5.yaml, so a regeneration that drifts from the
+ * robot description fails here.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+
+#include "wp5_kinematics/generated/Ur5Kinematics.h"
+
+namespace wp5_kinematics {
+
+namespace {
+
+using Configuration = std::array<double, Ur5Kinematics::NB_JOINTS>;
+
+// [a, alpha, d, theta_offset] of config/ur5.yaml
+constexpr double DH[6][4] = {{0.0, M_PI_2, 0.089159, 0.0},  {-0.425, 0.0, 0.0, 0.0},
+                             {-0.39225, 0.0, 0.0, 0.0},     {0.0, M_PI_2, 0.10915, 0.0},
+                             {0.0, -M_PI_2, 0.09465, 0.0},  {0.0, 0.0, 0.0823, 0.0}};
+
+const Configuration CONFIGURATIONS[] = {{0.0, 0.0, 0.0, 0.0, 0.0, 0.0},
+                                        {0.3, -1.2, 1.6, -1.9, -1.57, 0.4},
+                                        {-2.1, -0.7, -2.3, 0.8, 1.1, -3.0},
+                                        {1.0, -2.5, 0.5, 2.0, -0.3, 1.5}};
+
+Eigen::Isometry3d dhProduct(const Configuration& q) {
+  Eigen::Isometry3d transform = Eigen::Isometry3d::Identity();
+  for (int i = 0; i < Ur5Kinematics::NB_JOINTS; ++i) {
+    transform = transform * Eigen::AngleAxisd(q[i] + DH[i][3], Eigen::Vector3d::UnitZ()) *
+                Eigen::Translation3d(DH[i][0], 0.0, DH[i][2]) * Eigen::AngleAxisd(DH[i][1], Eigen::Vector3d::UnitX());
+  }
+  return transform;
+}
+
+Eigen::Isometry3d forward(const Configuration& q) {
+  Pose<double> pose;
+  Ur5Kinematics::forwardKinematics(q, pose);
+  return toIsometry(pose);
+}
+
+} // namespace
+
+TEST(Ur5Kinematics, MatchesDhProduct) {
+  for (const Configuration& q : CONFIGURATIONS) {
+    const Eigen::Isometry3d expected = dhProduct(q);
+    const Eigen::Isometry3d pose = forward(q);
+    EXPECT_TRUE(pose.translation().isApprox(expected.translation(), 1e-12)) << pose.translation().transpose();
+    EXPECT_TRUE(pose.linear().isApprox(expected.linear(), 1e-12));
+  }
+}
+
+TEST(Ur5Kinematics, JacobianMatchesFiniteDifferences) {
+  constexpr double STEP = 1e-7;
+  for (const Configuration& q : CONFIGURATIONS) {
+    Pose<double> pose;
+    Jacobian<double, Ur5Kinematics::NB_JOINTS> jacobian;
+    Ur5Kinematics::jacobian(q, pose, jacobian);
+    const Eigen::Matrix<double, 6, 6> analytic = toMatrix(jacobian);
+    const Eigen::Isometry3d center = toIsometry(pose);
+    EXPECT_TRUE(center.isApprox(forward(q), 1e-12));
+
+    for (int j = 0; j < Ur5Kinematics::NB_JOINTS; ++j) {
+      Configuration shifted = q;
+      shifted[j] += STEP;
+      const Eigen::Isometry3d next = forward(shifted);
+
+      const Eigen::Vector3d linear = (next.translation() - center.translation()) / STEP;
+      const Eigen::AngleAxisd delta(next.linear() * center.linear().transpose());
+      const Eigen::Vector3d angular = delta.axis() * delta.angle() / STEP;
+
+      EXPECT_TRUE(analytic.col(j).head<3>().isApprox(linear, 1e-5) || linear.norm() < 1e-9) << "joint " << j;
+      EXPECT_TRUE(analytic.col(j).tail<3>().isApprox(angular, 1e-5)) << "joint " << j;
+    }
+  }
+}
+
+TEST(Ur5Kinematics, BatchLanesMatchScalar) {
+  constexpr int NB_LANES = 4;
+  std::array<Batch<NB_LANES>, Ur5Kinematics::NB_JOINTS> q;
+  for (int j = 0; j < Ur5Kinematics::NB_JOINTS; ++j) {
+    for (int lane = 0; lane < NB_LANES; ++lane) {
+      q[j][lane] = CONFIGURATIONS[lane][j];
+    }
+  }
+
+  Pose<Batch<NB_LANES>> batch;
+  Ur5Kinematics::forwardKinematics(q, batch);
+
+  for (int lane = 0; lane < NB_LANES; ++lane) {
+    Pose<double> scalar;
+    Ur5Kinematics::forwardKinematics(CONFIGURATIONS[lane], scalar);
+    for (int i = 0; i < 9; ++i) {
+      EXPECT_DOUBLE_EQ(batch.rotation[i][lane], scalar.rotation[i]);
+    }
+    for (int i = 0; i < 3; ++i) {
+      EXPECT_DOUBLE_EQ(batch.translation[i][lane], scalar.translation[i]);
+    }
+  }
+}
+
+} // namespace wp5_kinematics
@@ -0,0 +1,121 @@
+/**
+ * @file FramePool.h
+ * @brief Pool of preallocated messages, handed out as shared pointers that return to the pool once released.
+ *
+ * In a nodelet manager, messages published as shared pointers reach the subscribers without serialization nor copy,
+ * so they live as long as their last subscriber holds them and cannot be written again in place. The pool hands out
+ * messages whose deleter gives them back instead of freeing them: a frame keeps its buffer across uses and, once the
+ * pool is warm, publishing costs neither allocation nor copy. Messages still held by a slow subscriber are simply not
+ * reused, the pool allocating new ones when empty.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <sensor_msgs/Image.h>
+#include <sensor_msgs/image_encodings.h>
+
+#include <boost/shared_ptr.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace wp5_meltpool {
+
+template <typename Message>
+class MessagePool : public std::enable_shared_from_this<MessagePool<Message>> {
+public:
+  /**
+   * @brief Create a pool holding up to capacity messages, all allocated upfront.
+   *
+   * The pool is shared with the deleters of the messages handed out, it may be destroyed before them.
+   */
+  static std::shared_ptr<MessagePool> create(std::size_t capacity) {
+    return std::shared_ptr<MessagePool>(new MessagePool(capacity));
+  }
+
+  /**
+   * @brief Message from the pool, or newly allocated when every message is in use.
+   *
+   * The message keeps the content of its previous use, buffers included.
+   */
+  boost::shared_ptr<Message> acquire() {
+    std::unique_ptr<Message> message;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!available_.empty()) {
+        message = std::move(available_.back());
+        available_.pop_back();
+      }
+    }
+    if (!message) {
+      message = std::make_unique<Message>();
+    }
+
+    return boost::shared_ptr<Message>(message.release(), Recycler{this->weak_from_this()});
+  }
+
+  std::size_t getCapacity() const { return capacity_; }
+
+  std::size_t getNbAvailable() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return available_.size();
+  }
+
+private:
+  struct Recycler {
+    std::weak_ptr<MessagePool> pool;
+
+    void operator()(Message* message) const {
+      std::unique_ptr<Message> owned(message);
+      if (const std::shared_ptr<MessagePool> alive = pool.lock()) {
+        alive->release_(std::move(owned));
+      }
+    }
+  };
+
+  explicit MessagePool(std::size_t capacity) : capacity_(capacity) {
+    available_.reserve(capacity_);
+    for (std::size_t i = 0; i < capacity_; ++i) {
+      available_.push_back(std::make_unique<Message>());
+    }
+  }
+
+  void release_(std::unique_ptr<Message> message) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (available_.size() < capacity_) {
+      available_.push_back(std::move(message));
+    }
+  }
+
+  const std::size_t capacity_;
+  mutable std::mutex mutex_;
+  std::vector<std::unique_ptr<Message>> available_;
+};
+
+using FramePool = MessagePool<sensor_msgs::Image>;
+
+/**
+ * @brief Frame from the pool with its layout set, its data sized without initialization when the buffer is reused.
+ */
+inline sensor_msgs::ImagePtr acquireFrame(FramePool& pool,
+                                          std::uint32_t height,
+                                          std::uint32_t width,
+                                          const std::string& encoding) {
+  sensor_msgs::ImagePtr frame = pool.acquire();
+  frame->height = height;
+  frame->width = width;
+  frame->encoding = encoding;
+  frame->is_bigendian = false;
+  frame->step = width * static_cast<std::uint32_t>(sensor_msgs::image_encodings::numChannels(encoding) *
+                                                   sensor_msgs::image_encodings::bitDepth(encoding) / 8);
+  frame->data.resize(static_cast<std::size_t>(frame->step) * height);
+  return frame;
+}
+
+} // namespace wp5_meltpool
@@ -0,0 +1,73 @@
+/**
+ * @file MeltPoolAnalyzer.h
+ * @brief Extraction of the melt pool geometry and intensity from process camera frames.
+ *
+ * The frame is thresholded in a region around the last melt pool, the largest blob is kept to reject spatter, and its
+ * image moments give the equivalent ellipse and the intensity weighted centroid. Thresholding and moments run on
+ * OpenCV's vectorized kernels, directly on the frame buffer, and every intermediate image is kept between frames, so
+ * no allocation happens once the melt pool size is stable. The whole frame is searched again when the melt pool is
+ * lost.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <opencv2/core.hpp>
+
+namespace wp5_meltpool {
+
+struct MeltPoolParameters {
+  double threshold = 200.0; // Intensity threshold, in the units of the frame
+  int minArea = 20;         // Smallest melt pool [px]
+  int roiMargin = 32;       // Margin around the last melt pool [px]
+  int maxLostFrames = 5;    // Frames without melt pool before searching the whole frame again
+  double pixelSize = 50e-6; // [m/px]
+};
+
+struct MeltPool {
+  bool valid = false;
+  double length = 0.0;      // [m], major axis of the equivalent ellipse
+  double width = 0.0;       // [m], minor axis
+  double orientation = 0.0; // [rad], major axis from the image x axis
+  double area = 0.0;        // [m^2]
+  cv::Point2d centroid;     // Intensity weighted [px]
+  double intensity = 0.0;   // Mean over the melt pool
+  cv::Rect roi;             // Searched region [px]
+};
+
+class MeltPoolAnalyzer {
+public:
+  explicit MeltPoolAnalyzer(const MeltPoolParameters& params = MeltPoolParameters()) : params_(params) {}
+
+  /**
+   * @brief Analyze a single channel frame, of any depth.
+   */
+  MeltPool analyze(const cv::Mat& frame);
+
+  const MeltPoolParameters& getParameters() const { return params_; }
+
+  void reset() {
+    tracking_ = false;
+    nbLost_ = 0;
+  }
+
+private:
+  cv::Rect searchRegion_(const cv::Size& size) const;
+
+  MeltPoolParameters params_;
+
+  bool tracking_ = false;
+  int nbLost_ = 0;
+  cv::Rect previous_; // Bounding box of the last melt pool [px]
+
+  cv::Mat mask_;
+  cv::Mat labels_;
+  cv::Mat stats_;
+  cv::Mat centroids_;
+  cv::Mat blob_;
+  cv::Mat weighted_;
+};
+
+} // namespace wp5_meltpool
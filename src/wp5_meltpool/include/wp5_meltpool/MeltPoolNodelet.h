@@ -0,0 +1,55 @@
+/**
+ * @file MeltPoolNodelet.h
+ * @brief Melt pool monitoring on the process camera stream.
+ *
+ * Frames are received through image_transport and shared with cv_bridge without conversion when single channel, so
+ * the analysis works on the received buffer. Loaded in the manager of the camera driver, the frame is the one the
+ * driver published, without copy. The melt pool of each frame is published on melt_pool, and optionally the searched
+ * region with the melt pool ellipse on debug_image, both from pools of recycled messages.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <image_transport/image_transport.h>
+#include <nodelet/nodelet.h>
+#include <ros/ros.h>
+#include <sensor_msgs/Image.h>
+#include <wp5_common/Metrics.h>
+#include <wp5_msgs/MeltPool.h>
+
+#include <memory>
+
+#include "wp5_meltpool/FramePool.h"
+#include "wp5_meltpool/MeltPoolAnalyzer.h"
+
+namespace wp5_meltpool {
+
+class MeltPoolNodelet : public nodelet::Nodelet {
+public:
+  void onInit() override;
+
+private:
+  void imageCallback_(const sensor_msgs::ImageConstPtr& msg);
+  void publishDebugImage_(const std_msgs::Header& header, const cv::Mat& frame, const MeltPool& meltPool);
+
+  MeltPoolAnalyzer analyzer_;
+  cv::Mat grey_;
+
+  std::shared_ptr<MessagePool<wp5_msgs::MeltPool>> meltPools_;
+  std::shared_ptr<FramePool> debugFrames_;
+
+  wp5_common::MetricsRegistry metrics_;
+  wp5_common::LoopMetric* frameLoop_ = nullptr;
+  wp5_common::Counter* droppedFrames_ = nullptr;
+  wp5_common::Gauge* freeMessages_ = nullptr;
+
+  std::unique_ptr<image_transport::ImageTransport> it_;
+  image_transport::Subscriber imageSub_;
+  image_transport::Publisher debugPub_;
+  ros::Publisher meltPoolPub_;
+};
+
+} // namespace wp5_meltpool
@@ -0,0 +1,103 @@
+/**
+ * @file MeltPoolAnalyzer.cpp
+ * @brief Extraction of the melt pool geometry and intensity from process camera frames.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include "wp5_meltpool/MeltPoolAnalyzer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <opencv2/imgproc.hpp>
+#include <stdexcept>
+
+namespace wp5_meltpool {
+
+cv::Rect MeltPoolAnalyzer::searchRegion_(const cv::Size& size) const {
+  const cv::Rect frame(cv::Point(0, 0), size);
+  if (!tracking_) {
+    return frame;
+  }
+
+  const int margin = params_.roiMargin;
+  return (previous_ - cv::Point(margin, margin) + cv::Size(2 * margin, 2 * margin)) & frame;
+}
+
+MeltPool MeltPoolAnalyzer::analyze(const cv::Mat& frame) {
+  if (frame.channels() != 1) {
+    throw std::invalid_argument("Melt pool analysis expects single channel frames.");
+  }
+
+  MeltPool meltPool;
+  if (frame.empty()) {
+    return meltPool;
+  }
+
+  meltPool.roi = searchRegion_(frame.size());
+  const cv::Mat view = frame(meltPool.roi);
+
+  // Binary mask of the hot pixels, the largest blob is the melt pool and the others spatter
+  cv::compare(view, params_.threshold, mask_, cv::CMP_GT);
+  const int nbLabels = cv::connectedComponentsWithStats(mask_, labels_, stats_, centroids_, 8, CV_32S);
+
+  int best = 0;
+  int bestArea = 0;
+  for (int label = 1; label < nbLabels; ++label) {
+    const int area = stats_.at<int>(label, cv::CC_STAT_AREA);
+    if (area > bestArea) {
+      best = label;
+      bestArea = area;
+    }
+  }
+
+  if (bestArea < params_.minArea) {
+    if (++nbLost_ >= params_.maxLostFrames) {
+      tracking_ = false;
+    }
+    return meltPool;
+  }
+
+  const cv::Rect box(stats_.at<int>(best, cv::CC_STAT_LEFT),
+                     stats_.at<int>(best, cv::CC_STAT_TOP),
+                     stats_.at<int>(best, cv::CC_STAT_WIDTH),
+                     stats_.at<int>(best, cv::CC_STAT_HEIGHT));
+  const cv::Mat pixels = view(box);
+  cv::compare(labels_(box), best, blob_, cv::CMP_EQ);
+
+  // Equivalent ellipse from the second order central moments of the blob
+  const cv::Moments shape = cv::moments(blob_, true);
+  const double a = shape.mu20 / shape.m00;
+  const double b = shape.mu11 / shape.m00;
+  const double c = shape.mu02 / shape.m00;
+  const double spread = std::sqrt(0.25 * (a - c) * (a - c) + b * b);
+  const double major = 0.5 * (a + c) + spread;
+  const double minor = std::max(0.0, 0.5 * (a + c) - spread);
+
+  meltPool.length = 4.0 * std::sqrt(major) * params_.pixelSize;
+  meltPool.width = 4.0 * std::sqrt(minor) * params_.pixelSize;
+  meltPool.orientation = 0.5 * std::atan2(2.0 * b, a - c);
+  meltPool.area = shape.m00 * params_.pixelSize * params_.pixelSize;
+
+  // Intensity weighted centroid, on the blob only
+  weighted_.create(box.size(), pixels.type());
+  weighted_.setTo(0);
+  pixels.copyTo(weighted_, blob_);
+  const cv::Moments intensity = cv::moments(weighted_, false);
+  if (intensity.m00 > 0.0) {
+    meltPool.centroid = cv::Point2d(intensity.m10 / intensity.m00, intensity.m01 / intensity.m00);
+  } else {
+    meltPool.centroid = cv::Point2d(shape.m10 / shape.m00, shape.m01 / shape.m00);
+  }
+  meltPool.centroid += cv::Point2d(meltPool.roi.x + box.x, meltPool.roi.y + box.y);
+  meltPool.intensity = cv::mean(pixels, blob_)[0];
+  meltPool.valid = true;
+
+  previous_ = box + meltPool.roi.tl();
+  tracking_ = true;
+  nbLost_ = 0;
+  return meltPool;
+}
+
+} // namespace wp5_meltpool
@@ -0,0 +1,130 @@
+/**
+ * @file MeltPoolNodelet.cpp
+ * @brief Melt pool monitoring on the process camera stream.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include "wp5_meltpool/MeltPoolNodelet.h"
+
+#include <cv_bridge/cv_bridge.h>
+#include <pluginlib/class_list_macros.h>
+#include <sensor_msgs/image_encodings.h>
+#include <wp5_common/TraceRecorder.h>
+#include <wp5_common/Tracing.h>
+
+#include <algorithm>
+#include <opencv2/imgproc.hpp>
+#include <stdexcept>
+
+namespace wp5_meltpool {
+
+void MeltPoolNodelet::onInit() {
+  ros::NodeHandle& nh = getNodeHandle();
+  ros::NodeHandle& pnh = getPrivateNodeHandle();
+
+  MeltPoolParameters params;
+  params.threshold = pnh.param("threshold", params.threshold);
+  params.minArea = pnh.param("min_area", params.minArea);
+  params.roiMargin = pnh.param("roi_margin", params.roiMargin);
+  params.maxLostFrames = pnh.param("max_lost_frames", params.maxLostFrames);
+  params.pixelSize = pnh.param("pixel_size", params.pixelSize);
+  analyzer_ = MeltPoolAnalyzer(params);
+
+  // Published messages are recycled, subscribers in the same manager receive them without copy
+  const std::size_t poolSize = static_cast<std::size_t>(std::max(1, pnh.param("pool_size", 8)));
+  meltPools_ = MessagePool<wp5_msgs::MeltPool>::create(poolSize);
+  meltPoolPub_ = nh.advertise<wp5_msgs::MeltPool>("melt_pool", 8);
+
+  frameLoop_ = &metrics_.loop("frame", pnh.param("diagnostics/nominal_rate", 0.0));
+  droppedFrames_ = &metrics_.drops("frames");
+  freeMessages_ = &metrics_.gauge("free pooled messages");
+  metrics_.advertise(nh, pnh, getName(), "Melt pool");
+
+  it_ = std::make_unique<image_transport::ImageTransport>(nh);
+  if (pnh.param("publish_debug", false)) {
+    debugFrames_ = FramePool::create(poolSize);
+    debugPub_ = it_->advertise("melt_pool/debug_image", 1);
+  }
+
+  // Raw frames by default, a compressed transport would decode every frame
+  imageSub_ = it_->subscribe("image",
+                             1,
+                             &MeltPoolNodelet::imageCallback_,
+                             this,
+                             image_transport::TransportHints("raw", ros::TransportHints().tcpNoDelay(), pnh));
+
+  wp5_common::TraceRecorder::attach(nh);
+}
+
+void MeltPoolNodelet::imageCallback_(const sensor_msgs::ImageConstPtr& msg) {
+  namespace encodings = sensor_msgs::image_encodings;
+  WP5_TRACE_SCOPE("meltpool", "frame");
+  frameLoop_->tick();
+  droppedFrames_->addSequenceGap(msg->header.seq);
+
+  // The frame is shared with the publisher, only colour frames are converted to grey, in a reused buffer
+  cv::Mat image;
+  try {
+    const cv_bridge::CvImageConstPtr frame = cv_bridge::toCvShare(msg);
+    if (frame->image.channels() == 1) {
+      image = frame->image;
+    } else if (msg->encoding == encodings::BGR8 || msg->encoding == encodings::BGRA8) {
+      cv::cvtColor(frame->image, grey_, frame->image.channels() == 3 ? cv::COLOR_BGR2GRAY : cv::COLOR_BGRA2GRAY);
+      image = grey_;
+    } else if (msg->encoding == encodings::RGB8 || msg->encoding == encodings::RGBA8) {
+      cv::cvtColor(frame->image, grey_, frame->image.channels() == 3 ? cv::COLOR_RGB2GRAY : cv::COLOR_RGBA2GRAY);
+      image = grey_;
+    } else {
+      image = cv_bridge::toCvShare(msg, encodings::MONO8)->image;
+    }
+  } catch (const std::exception& e) {
+    NODELET_ERROR_STREAM_THROTTLE(1.0, "[MeltPoolNodelet] - Invalid frame: " << e.what());
+    return;
+  }
+
+  const MeltPool meltPool = analyzer_.analyze(image);
+
+  const boost::shared_ptr<wp5_msgs::MeltPool> meltPoolMsg = meltPools_->acquire();
+  freeMessages_->set(static_cast<std::int64_t>(meltPools_->getNbAvailable()));
+  meltPoolMsg->header = msg->header;
+  meltPoolMsg->valid = meltPool.valid;
+  meltPoolMsg->length = meltPool.length;
+  meltPoolMsg->width = meltPool.width;
+  meltPoolMsg->orientation = meltPool.orientation;
+  meltPoolMsg->area = meltPool.area;
+  meltPoolMsg->centroid_x = meltPool.centroid.x;
+  meltPoolMsg->centroid_y = meltPool.centroid.y;
+  meltPoolMsg->intensity = meltPool.intensity;
+  meltPoolPub_.publish(meltPoolMsg);
+
+  if (debugPub_ && debugPub_.getNumSubscribers() > 0) {
+    publishDebugImage_(msg->header, image, meltPool);
+  }
+}
+
+void MeltPoolNodelet::publishDebugImage_(const std_msgs::Header& header,
+                                         const cv::Mat& frame,
+                                         const MeltPool& meltPool) {
+  // Searched region stretched to 8 bits, with the equivalent ellipse of the melt pool, drawn in a pooled frame
+  const sensor_msgs::ImagePtr debugMsg =
+      acquireFrame(*debugFrames_, meltPool.roi.height, meltPool.roi.width, sensor_msgs::image_encodings::MONO8);
+  debugMsg->header = header;
+  cv::Mat debug(meltPool.roi.size(), CV_8UC1, debugMsg->data.data(), debugMsg->step);
+  cv::normalize(frame(meltPool.roi), debug, 0, 255, cv::NORM_MINMAX, CV_8U);
+
+  if (meltPool.valid) {
+    const double pixelSize = analyzer_.getParameters().pixelSize;
+    const cv::Point2f center(meltPool.centroid.x - meltPool.roi.x, meltPool.centroid.y - meltPool.roi.y);
+    const cv::Size2f axes(meltPool.length / pixelSize, meltPool.width / pixelSize);
+    cv::ellipse(debug, cv::RotatedRect(center, axes, meltPool.orientation * 180.0 / CV_PI), cv::Scalar(128), 1);
+    cv::drawMarker(debug, center, cv::Scalar(0), cv::MARKER_CROSS, 8, 1);
+  }
+
+  debugPub_.publish(debugMsg);
+}
+
+} // namespace wp5_meltpool
+
+PLUGINLIB_EXPORT_CLASS(wp5_meltpool::MeltPoolNodelet, nodelet::Nodelet)
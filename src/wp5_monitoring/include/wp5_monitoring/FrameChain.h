@@ -0,0 +1,63 @@
+/**
+ * @file FrameChain.h
+ * @brief Joints of the cell description from its root to a frame, composed with Eigen.
+ *
+ * Covers what the generated kinematics of wp5_kinematics do not, the robot mounting and the positioner. Fixed joints
+ * are folded into the origins of the moving ones when the description is read, an evaluation then only composes one
+ * isometry per moving joint.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <urdf_model/model.h>
+
+#include <Eigen/Geometry>
+#include <string>
+#include <vector>
+
+namespace wp5_monitoring {
+
+class FrameChain {
+public:
+  FrameChain() = default;
+
+  /**
+   * @param model Cell description.
+   * @param frame Last link of the chain.
+   * @param jointNames Joint vector of the caller, the joints of the chain missing from it are appended.
+   */
+  FrameChain(const urdf::ModelInterface& model, const std::string& frame, std::vector<std::string>& jointNames);
+
+  std::size_t getNbJoints() const { return joints_.size(); }
+
+  /**
+   * @brief Transform from the root to the frame, indexed as the joint vector given at construction.
+   */
+  const Eigen::Isometry3d& evaluate(const std::vector<double>& positions);
+
+  /**
+   * @brief Velocity in the root frame of a point rigidly attached to the frame, from the last evaluation.
+   */
+  Eigen::Vector3d pointVelocity(const Eigen::Vector3d& point, const std::vector<double>& velocities) const;
+
+private:
+  struct Joint {
+    std::size_t index = 0; // In the joint vector of the caller
+    Eigen::Isometry3d origin = Eigen::Isometry3d::Identity(); // From the previous moving joint
+    Eigen::Vector3d axis = Eigen::Vector3d::UnitZ();
+    bool prismatic = false;
+
+    // Last evaluation, in the root frame
+    Eigen::Vector3d position = Eigen::Vector3d::Zero();
+    Eigen::Vector3d worldAxis = Eigen::Vector3d::UnitZ();
+  };
+
+  std::vector<Joint> joints_; // From the root
+  Eigen::Isometry3d tip_ = Eigen::Isometry3d::Identity(); // Fixed joints after the last moving one
+  Eigen::Isometry3d transform_ = Eigen::Isometry3d::Identity();
+};
+
+} // namespace wp5_monitoring
@@ -0,0 +1,55 @@
+/**
+ * @file PlannedPath.h
+ * @brief Planned TCP polyline with timing and orientations, and projection of measured TCP positions on it.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+#include <cstddef>
+#include <vector>
+
+namespace wp5_monitoring {
+
+class PlannedPath {
+public:
+  struct Projection {
+    std::size_t segment = 0;
+    double pathPosition = 0.0; // Curvilinear abscissa of the closest point [m]
+    double plannedSpeed = 0.0; // [m/s]
+    Eigen::Vector3d closest = Eigen::Vector3d::Zero();
+    Eigen::Vector3d tangent = Eigen::Vector3d::UnitX();
+    Eigen::Quaterniond orientation = Eigen::Quaterniond::Identity(); // Slerped between the segment ends
+  };
+
+  /**
+   * @param points Planned TCP positions.
+   * @param times Time from start of each point [s], same size as points.
+   * @param orientations Planned TCP orientations, same size as points or empty when not planned.
+   */
+  PlannedPath(std::vector<Eigen::Vector3d> points,
+              const std::vector<double>& times,
+              std::vector<Eigen::Quaterniond> orientations = {});
+
+  std::size_t size() const { return points_.size(); }
+  double length() const { return abscissa_.empty() ? 0.0 : abscissa_.back(); }
+
+  /**
+   * @brief Closest point of the path, searched in a window around the previous segment.
+   *
+   * The TCP moves forward along the path, so starting from the last match keeps the search constant time per sample.
+   */
+  Projection project(const Eigen::Vector3d& point, std::size_t hint, std::size_t window = 32) const;
+
+private:
+  std::vector<Eigen::Vector3d> points_;
+  std::vector<Eigen::Quaterniond> orientations_;
+  std::vector<double> abscissa_;
+  std::vector<double> speeds_; // Planned speed of each segment
+};
+
+} // namespace wp5_monitoring
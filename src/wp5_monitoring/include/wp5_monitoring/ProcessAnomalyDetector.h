@@ -0,0 +1,100 @@
+/**
+ * @file ProcessAnomalyDetector.h
+ * @brief Streaming detection of spatter and porosity from the arc electrical data and the melt pool.
+ *
+ * Current and voltage samples feed sliding statistics, a sliding DFT of the current over the band where droplet
+ * transfer disturbances show up, and the rate of short circuits. Melt pool frames feed the statistics of its area and
+ * intensity. Every update costs a bounded number of operations, so the scores are evaluated after each batch of
+ * samples and an alarm is raised within the batch period.
+ *
+ * - Spatter: frequent short circuits or current energy concentrated in the monitored band.
+ * - Porosity: unstable arc voltage, confirmed by a fluctuating melt pool when frames are received.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "wp5_monitoring/SlidingWindow.h"
+
+namespace wp5_monitoring {
+
+struct AnomalyDetectorParameters {
+  double sampleRate = 10000.0;      // Arc electrical samples [Hz]
+  double window = 0.05;             // [s]
+  double bandLow = 100.0;           // Monitored band of the current spectrum [Hz]
+  double bandHigh = 1000.0;         // [Hz]
+  double shortCircuitVoltage = 5.0; // [V]
+
+  std::size_t meltPoolWindow = 20; // Frames
+  double meltPoolTimeout = 0.1;    // Melt pool ignored without frame for [s]
+
+  // Alarm thresholds
+  double maxShortCircuitRate = 150.0; // [1/s]
+  double maxSpectralRatio = 0.5;      // Share of the current variance in the band
+  double maxVoltageDeviation = 2.0;   // [V]
+  double maxMeltPoolVariation = 0.25; // Standard deviation of the area over its mean
+
+  double holdTime = 0.5; // Same alarm raised again after [s]
+};
+
+enum class AnomalyType { Spatter = 0, Porosity = 1 };
+
+struct Anomaly {
+  AnomalyType type = AnomalyType::Spatter;
+  double time = 0.0; // [s]
+  double score = 0.0;
+};
+
+struct ProcessFeatures {
+  double currentMean = 0.0;      // [A]
+  double currentDeviation = 0.0; // [A]
+  double voltageMean = 0.0;      // [V]
+  double voltageDeviation = 0.0; // [V]
+  double spectralRatio = 0.0;
+  double shortCircuitRate = 0.0; // [1/s]
+  double meltPoolArea = 0.0;     // [m^2]
+  double meltPoolVariation = 0.0;
+  double meltPoolIntensity = 0.0;
+  double spatterScore = 0.0;
+  double porosityScore = 0.0;
+};
+
+class ProcessAnomalyDetector {
+public:
+  explicit ProcessAnomalyDetector(const AnomalyDetectorParameters& params = AnomalyDetectorParameters());
+
+  void addArcSample(double current, double voltage);
+  void addMeltPool(double time, double area, double intensity);
+
+  /**
+   * @brief Scores at the given time, the anomalies whose alarm is raised are appended.
+   *
+   * Nothing is raised before the arc window is filled.
+   */
+  ProcessFeatures evaluate(double time, std::vector<Anomaly>& anomalies);
+
+  void reset();
+
+private:
+  AnomalyDetectorParameters params_;
+
+  SlidingStatistics current_;
+  SlidingStatistics voltage_;
+  SlidingStatistics shortCircuits_; // 1 on the first sample of each short circuit
+  SlidingDft currentSpectrum_;
+  bool shorted_ = false;
+
+  SlidingStatistics meltPoolArea_;
+  SlidingStatistics meltPoolIntensity_;
+  double lastMeltPool_ = -1.0;
+
+  std::array<double, 2> lastAlarm_;
+};
+
+} // namespace wp5_monitoring
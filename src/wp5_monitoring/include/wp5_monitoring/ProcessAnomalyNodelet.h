@@ -0,0 +1,63 @@
+/**
+ * @file ProcessAnomalyNodelet.h
+ * @brief Streaming anomaly detection on the arc electrical data and the melt pool.
+ *
+ * Batches of current and voltage samples received on arc_samples and melt pool frames received on melt_pool feed a
+ * ProcessAnomalyDetector. The scores are evaluated after every message and alarms published right away on
+ * process_anomaly, the features being published on process_features at a lower rate.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <nodelet/nodelet.h>
+#include <ros/ros.h>
+#include <wp5_common/Metrics.h>
+#include <wp5_msgs/ArcSamples.h>
+#include <wp5_msgs/MeltPool.h>
+#include <wp5_msgs/ProcessAnomaly.h>
+#include <wp5_msgs/ProcessFeatures.h>
+
+#include <mutex>
+#include <vector>
+
+#include "wp5_monitoring/ProcessAnomalyDetector.h"
+
+namespace wp5_monitoring {
+
+class ProcessAnomalyNodelet : public nodelet::Nodelet {
+public:
+  void onInit() override;
+
+private:
+  void arcSamplesCallback_(const wp5_msgs::ArcSamplesConstPtr& msg);
+  void meltPoolCallback_(const wp5_msgs::MeltPoolConstPtr& msg);
+
+  // Called with the detector locked
+  void evaluate_(const ros::Time& stamp);
+
+  std::mutex mutex_;
+  ProcessAnomalyDetector detector_;
+  double sampleRate_ = 0.0;
+  std::vector<Anomaly> anomalies_;
+
+  double featuresPeriod_ = 0.01; // [s]
+  ros::Time lastFeatures_;
+  wp5_msgs::ProcessFeatures features_;
+  wp5_msgs::ProcessAnomaly anomaly_;
+
+  wp5_common::MetricsRegistry metrics_;
+  wp5_common::LoopMetric* arcSamplesLoop_ = nullptr;
+  wp5_common::LoopMetric* meltPoolLoop_ = nullptr;
+  wp5_common::Counter* droppedArcSamples_ = nullptr;
+  wp5_common::Counter* droppedMeltPools_ = nullptr;
+
+  ros::Subscriber arcSamplesSub_;
+  ros::Subscriber meltPoolSub_;
+  ros::Publisher anomalyPub_;
+  ros::Publisher featuresPub_;
+};
+
+} // namespace wp5_monitoring
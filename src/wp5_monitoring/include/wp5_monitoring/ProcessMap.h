@@ -0,0 +1,86 @@
+/**
+ * @file ProcessMap.h
+ * @brief Process data indexed by the TCP position, in a sparse voxel hash aligned with the as-built part.
+ *
+ * Voxels are created on the first sample taken in them and keep running aggregates of the process features, TCP
+ * deviations and anomalies, so the memory follows the deposited volume and not its bounding box. A region query
+ * enumerates the voxels of the box when it is smaller than the map, the map otherwise.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "wp5_monitoring/ProcessAnomalyDetector.h"
+
+namespace wp5_monitoring {
+
+struct ProcessVoxel {
+  std::uint32_t nbSamples = 0;
+  double currentMean = 0.0;      // [A]
+  double voltageDeviation = 0.0; // [V]
+  double meltPoolArea = 0.0;     // [m^2]
+  double maxSpatterScore = 0.0;
+  double maxPorosityScore = 0.0;
+
+  std::uint32_t nbDeviations = 0;
+  double speedError = 0.0;      // [m/s], mean of the absolute error
+  double maxLateralError = 0.0; // [m]
+
+  std::uint32_t nbSpatter = 0;
+  std::uint32_t nbPorosity = 0;
+
+  double firstTime = 0.0; // [s]
+  double lastTime = 0.0;  // [s]
+};
+
+class ProcessMap {
+public:
+  /**
+   * @param voxelSize Edge of the voxels [m].
+   * @param origin Corner of the voxel of index zero, to align the voxels with the as-built model [m].
+   */
+  explicit ProcessMap(double voxelSize = 2e-3, const Eigen::Vector3d& origin = Eigen::Vector3d::Zero());
+
+  void addFeatures(const Eigen::Vector3d& position, double time, const ProcessFeatures& features);
+  void addDeviation(const Eigen::Vector3d& position, double time, double speedError, double lateralError);
+  void addAnomaly(const Eigen::Vector3d& position, double time, AnomalyType type);
+
+  /**
+   * @brief Voxels overlapping the box, with their center.
+   */
+  std::vector<std::pair<Eigen::Vector3d, ProcessVoxel>> query(const Eigen::Vector3d& min,
+                                                              const Eigen::Vector3d& max) const;
+
+  void clear() { voxels_.clear(); }
+
+  std::size_t size() const { return voxels_.size(); }
+  double getVoxelSize() const { return voxelSize_; }
+
+private:
+  using Key = std::uint64_t;
+
+  // 21 bits per axis, offset to keep the indices positive
+  static constexpr std::int64_t KEY_OFFSET = 1 << 20;
+  static constexpr std::int64_t KEY_MASK = (1 << 21) - 1;
+
+  Eigen::Vector3i index_(const Eigen::Vector3d& position) const;
+  static Key key_(const Eigen::Vector3i& index);
+  static Eigen::Vector3i unpack_(Key key);
+  Eigen::Vector3d center_(const Eigen::Vector3i& index) const;
+
+  ProcessVoxel& voxel_(const Eigen::Vector3d& position, double time);
+
+  double voxelSize_;
+  Eigen::Vector3d origin_;
+  std::unordered_map<Key, ProcessVoxel> voxels_;
+};
+
+} // namespace wp5_monitoring
@@ -0,0 +1,69 @@
+/**
+ * @file ProcessMapNodelet.h
+ * @brief Process data mapped on the part by the TCP position, queryable by region.
+ *
+ * TCP positions are taken from the deviations of the TCP monitor, expressed in the part frame, and kept over a short
+ * history. Process features and anomalies are placed at the TCP position interpolated at their stamp, so the different
+ * rates and latencies of the sources do not shift the data along the path.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <nodelet/nodelet.h>
+#include <ros/ros.h>
+#include <std_srvs/Empty.h>
+#include <wp5_common/Metrics.h>
+#include <wp5_msgs/ProcessAnomaly.h>
+#include <wp5_msgs/ProcessFeatures.h>
+#include <wp5_msgs/QueryProcessMap.h>
+#include <wp5_msgs/TcpDeviation.h>
+
+#include <Eigen/Core>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include "wp5_monitoring/ProcessMap.h"
+
+namespace wp5_monitoring {
+
+class ProcessMapNodelet : public nodelet::Nodelet {
+public:
+  void onInit() override;
+
+private:
+  void deviationCallback_(const wp5_msgs::TcpDeviationConstPtr& msg);
+  void featuresCallback_(const wp5_msgs::ProcessFeaturesConstPtr& msg);
+  void anomalyCallback_(const wp5_msgs::ProcessAnomalyConstPtr& msg);
+  bool queryCallback_(wp5_msgs::QueryProcessMap::Request& req, wp5_msgs::QueryProcessMap::Response& res);
+  bool resetCallback_(std_srvs::Empty::Request& req, std_srvs::Empty::Response& res);
+
+  // TCP position at the stamp, false when the history does not cover it. Called with the map locked
+  bool positionAt_(const ros::Time& stamp, Eigen::Vector3d& position) const;
+
+  std::mutex mutex_;
+  ProcessMap map_;
+  std::deque<std::pair<ros::Time, Eigen::Vector3d>> history_;
+  bool arcOn_ = false;
+
+  std::string frameId_;
+  double minCurrent_ = 10.0;   // [A]
+  double historyLength_ = 2.0; // [s]
+  double maxGap_ = 0.05;       // Largest distance in time to the TCP positions [s]
+
+  wp5_common::MetricsRegistry metrics_;
+  wp5_common::Gauge* historySize_ = nullptr;
+  wp5_common::Counter* unlocatedSamples_ = nullptr;
+
+  ros::Subscriber deviationSub_;
+  ros::Subscriber featuresSub_;
+  ros::Subscriber anomalySub_;
+  ros::ServiceServer queryService_;
+  ros::ServiceServer resetService_;
+};
+
+} // namespace wp5_monitoring
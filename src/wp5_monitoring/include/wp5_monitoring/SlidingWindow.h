@@ -0,0 +1,80 @@
+/**
+ * @file SlidingWindow.h
+ * @brief Statistics and spectrum of a signal over a sliding window, updated in constant time per sample.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <complex>
+#include <cstddef>
+#include <vector>
+
+namespace wp5_monitoring {
+
+/**
+ * @brief Mean and variance over the last samples, with a Welford update on insertion and removal.
+ */
+class SlidingStatistics {
+public:
+  explicit SlidingStatistics(std::size_t window = 1);
+
+  void add(double value);
+  void reset();
+
+  std::size_t size() const { return count_; }
+  bool full() const { return count_ == values_.size(); }
+
+  double mean() const { return mean_; }
+  double variance() const { return count_ > 0 ? squares_ / count_ : 0.0; }
+  double deviation() const;
+
+private:
+  std::vector<double> values_;
+  std::size_t next_ = 0;
+  std::size_t count_ = 0;
+  double mean_ = 0.0;
+  double squares_ = 0.0; // Sum of the squared deviations to the mean
+};
+
+/**
+ * @brief Sliding discrete Fourier transform over a band of frequency bins.
+ *
+ * Each sample updates the monitored bins in O(nbBins), instead of a full transform per window. The recursion is damped
+ * slightly so that rounding errors fade out instead of accumulating.
+ */
+class SlidingDft {
+public:
+  /**
+   * @param window Samples in the transform.
+   * @param firstBin First monitored bin, at frequency firstBin / window of the sample rate.
+   * @param lastBin Last monitored bin, included, at most window / 2.
+   */
+  SlidingDft(std::size_t window, std::size_t firstBin, std::size_t lastBin);
+
+  void add(double value);
+  void reset();
+
+  bool full() const { return count_ == samples_.size(); }
+
+  /**
+   * @brief Mean square of the signal in the monitored band, comparable to the variance of the window.
+   */
+  double bandPower() const;
+
+private:
+  static constexpr double DAMPING = 1.0 - 1e-7;
+
+  std::vector<double> samples_;
+  std::size_t next_ = 0;
+  std::size_t count_ = 0;
+  std::size_t firstBin_ = 0;
+
+  double dampingWindow_ = 1.0; // Damping over a whole window
+  std::vector<std::complex<double>> twiddles_;
+  std::vector<std::complex<double>> bins_;
+};
+
+} // namespace wp5_monitoring
@@ -0,0 +1,88 @@
+/**
+ * @file TcpMonitorNodelet.h
+ * @brief Real-time TCP speed and path deviation monitor, computed from the joint states.
+ *
+ * The robot runs on the generated kinematics of wp5_kinematics, its mounting and the positioner are read from the cell
+ * description once at startup, and the torch TCP is a fixed offset from the tool frame of the kinematics. Every
+ * joint_states message then only costs one generated forward kinematics and Jacobian, a few transforms for the
+ * positioner and a windowed projection on the planned path. Deviations are published for each joint state, so at the
+ * controller rate.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <nodelet/nodelet.h>
+#include <ros/ros.h>
+#include <sensor_msgs/JointState.h>
+#include <trajectory_msgs/JointTrajectory.h>
+#include <wp5_common/Metrics.h>
+#include <wp5_kinematics/generated/Ur5Kinematics.h>
+#include <wp5_msgs/TcpDeviation.h>
+
+#include <array>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "wp5_monitoring/FrameChain.h"
+#include "wp5_monitoring/PlannedPath.h"
+
+namespace wp5_monitoring {
+
+class TcpMonitorNodelet : public nodelet::Nodelet {
+public:
+  void onInit() override;
+
+private:
+  using Kinematics = wp5_kinematics::Ur5Kinematics;
+
+  void plannedTrajectoryCallback_(const trajectory_msgs::JointTrajectoryConstPtr& msg);
+  void jointStatesCallback_(const sensor_msgs::JointStateConstPtr& msg);
+
+  // Index in the chain of each name, -1 for joints outside the chain
+  std::vector<int> mapJoints_(const std::vector<std::string>& names) const;
+
+  std::string referenceFrame_;
+  std::size_t searchWindow_ = 32;
+
+  // Robot joints first, in the order of the generated kinematics, then the joints of the chains
+  std::vector<std::string> chainJoints_;
+  FrameChain referenceChain_; // Root of the description to reference_frame
+  FrameChain baseChain_; // Root of the description to robot_base_frame
+  Eigen::Isometry3d kinematicsBase_ = Eigen::Isometry3d::Identity(); // DH base in robot_base_frame
+  Eigen::Isometry3d tcpOffset_ = Eigen::Isometry3d::Identity(); // Torch TCP in the tool frame of the kinematics
+
+  std::vector<double> q_;
+  std::vector<double> qd_;
+  std::array<double, Kinematics::NB_JOINTS> armPositions_{};
+  wp5_kinematics::Pose<double> armPose_;
+  wp5_kinematics::Jacobian<double, Kinematics::NB_JOINTS> armJacobian_;
+
+  // Joint state layout is fixed by the driver, the mapping is computed once
+  std::vector<std::string> stateNames_;
+  std::vector<int> stateMapping_;
+
+  std::mutex pathMutex_;
+  std::shared_ptr<const PlannedPath> path_;
+  std::size_t lastSegment_ = 0;
+
+  bool hasPrevious_ = false;
+  ros::Time previousStamp_;
+  Eigen::Vector3d previousPosition_;
+
+  wp5_msgs::TcpDeviation deviation_;
+
+  wp5_common::MetricsRegistry metrics_;
+  wp5_common::LoopMetric* jointStatesLoop_ = nullptr;
+  wp5_common::Counter* droppedJointStates_ = nullptr;
+
+  ros::Subscriber jointStatesSub_;
+  ros::Subscriber plannedTrajectorySub_;
+  ros::Publisher deviationPub_;
+};
+
+} // namespace wp5_monitoring
@@ -0,0 +1,105 @@
+/**
+ * @file FrameChain.cpp
+ * @brief Joints of the cell description from its root to a frame, composed with Eigen.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include "wp5_monitoring/FrameChain.h"
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+namespace wp5_monitoring {
+
+namespace {
+
+Eigen::Isometry3d toIsometry(const urdf::Pose& pose) {
+  double x = 0.0, y = 0.0, z = 0.0, w = 1.0;
+  pose.rotation.getQuaternion(x, y, z, w);
+
+  Eigen::Isometry3d transform = Eigen::Isometry3d::Identity();
+  transform.linear() = Eigen::Quaterniond(w, x, y, z).normalized().toRotationMatrix();
+  transform.translation() << pose.position.x, pose.position.y, pose.position.z;
+  return transform;
+}
+
+} // namespace
+
+FrameChain::FrameChain(const urdf::ModelInterface& model,
+                       const std::string& frame,
+                       std::vector<std::string>& jointNames) {
+  urdf::LinkConstSharedPtr link = model.getLink(frame);
+  if (!link) {
+    throw std::invalid_argument("[FrameChain] - No link " + frame + " in the description.");
+  }
+
+  // Walk up to the root, then fold the fixed joints from the root down
+  std::vector<urdf::JointConstSharedPtr> path;
+  while (link && link->parent_joint) {
+    path.push_back(link->parent_joint);
+    link = model.getLink(link->parent_joint->parent_link_name);
+  }
+
+  Eigen::Isometry3d fixed = Eigen::Isometry3d::Identity();
+  for (auto it = path.rbegin(); it != path.rend(); ++it) {
+    const urdf::Joint& joint = **it;
+    fixed = fixed * toIsometry(joint.parent_to_joint_origin_transform);
+
+    if (joint.type == urdf::Joint::FIXED) {
+      continue;
+    }
+    if (joint.type != urdf::Joint::REVOLUTE && joint.type != urdf::Joint::CONTINUOUS
+        && joint.type != urdf::Joint::PRISMATIC) {
+      throw std::invalid_argument("[FrameChain] - Unsupported type of joint " + joint.name + ".");
+    }
+
+    Joint moving;
+    moving.origin = fixed;
+    moving.axis = Eigen::Vector3d(joint.axis.x, joint.axis.y, joint.axis.z).normalized();
+    moving.prismatic = joint.type == urdf::Joint::PRISMATIC;
+
+    auto name = std::find(jointNames.begin(), jointNames.end(), joint.name);
+    moving.index = static_cast<std::size_t>(std::distance(jointNames.begin(), name));
+    if (name == jointNames.end()) {
+      jointNames.push_back(joint.name);
+    }
+
+    joints_.push_back(moving);
+    fixed.setIdentity();
+  }
+  tip_ = fixed;
+  transform_ = tip_;
+}
+
+const Eigen::Isometry3d& FrameChain::evaluate(const std::vector<double>& positions) {
+  transform_.setIdentity();
+  for (Joint& joint : joints_) {
+    transform_ = transform_ * joint.origin;
+    joint.position = transform_.translation();
+    joint.worldAxis = transform_.linear() * joint.axis;
+
+    const double q = positions[joint.index];
+    if (joint.prismatic) {
+      transform_.translate(q * joint.axis);
+    } else {
+      transform_.rotate(Eigen::AngleAxisd(q, joint.axis));
+    }
+  }
+  transform_ = transform_ * tip_;
+  return transform_;
+}
+
+Eigen::Vector3d FrameChain::pointVelocity(const Eigen::Vector3d& point, const std::vector<double>& velocities) const {
+  Eigen::Vector3d velocity = Eigen::Vector3d::Zero();
+  for (const Joint& joint : joints_) {
+    const double qd = velocities[joint.index];
+    velocity += joint.prismatic ? Eigen::Vector3d(joint.worldAxis * qd)
+                                : Eigen::Vector3d(joint.worldAxis.cross(point - joint.position) * qd);
+  }
+  return velocity;
+}
+
+} // namespace wp5_monitoring
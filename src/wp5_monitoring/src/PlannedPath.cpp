@@ -0,0 +1,83 @@
+/**
+ * @file PlannedPath.cpp
+ * @brief Planned TCP polyline with timing and orientations, and projection of measured TCP positions on it.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include "wp5_monitoring/PlannedPath.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace wp5_monitoring {
+
+PlannedPath::PlannedPath(std::vector<Eigen::Vector3d> points,
+                         const std::vector<double>& times,
+                         std::vector<Eigen::Quaterniond> orientations) :
+    points_(std::move(points)), orientations_(std::move(orientations)) {
+  if (points_.size() != times.size()) {
+    throw std::invalid_argument("[PlannedPath] - Points and times size mismatch.");
+  }
+  if (!orientations_.empty() && orientations_.size() != points_.size()) {
+    throw std::invalid_argument("[PlannedPath] - Points and orientations size mismatch.");
+  }
+
+  abscissa_.resize(points_.size(), 0.0);
+  speeds_.resize(points_.size() > 1 ? points_.size() - 1 : 0, 0.0);
+
+  for (std::size_t i = 1; i < points_.size(); ++i) {
+    const double length = (points_[i] - points_[i - 1]).norm();
+    const double duration = times[i] - times[i - 1];
+
+    abscissa_[i] = abscissa_[i - 1] + length;
+    speeds_[i - 1] = duration > 0.0 ? length / duration : 0.0;
+  }
+}
+
+PlannedPath::Projection PlannedPath::project(const Eigen::Vector3d& point, std::size_t hint, std::size_t window) const {
+  Projection best;
+  if (points_.size() < 2) {
+    if (!points_.empty()) {
+      best.closest = points_.front();
+    }
+    return best;
+  }
+
+  const std::size_t nbSegments = points_.size() - 1;
+  const std::size_t first = hint > window / 4 ? std::min(hint - window / 4, nbSegments - 1) : 0;
+  const std::size_t last = std::min(first + window, nbSegments);
+
+  double bestDistance = std::numeric_limits<double>::infinity();
+  double bestRatio = 0.0;
+  for (std::size_t i = first; i < last; ++i) {
+    const Eigen::Vector3d segment = points_[i + 1] - points_[i];
+    const double length2 = segment.squaredNorm();
+    const double t = length2 > 0.0 ? std::clamp((point - points_[i]).dot(segment) / length2, 0.0, 1.0) : 0.0;
+    const Eigen::Vector3d closest = points_[i] + t * segment;
+    const double distance = (point - closest).squaredNorm();
+
+    if (distance < bestDistance) {
+      bestDistance = distance;
+      bestRatio = t;
+      best.segment = i;
+      best.pathPosition = abscissa_[i] + t * (abscissa_[i + 1] - abscissa_[i]);
+      best.plannedSpeed = speeds_[i];
+      best.closest = closest;
+      if (length2 > 0.0) {
+        best.tangent = segment / std::sqrt(length2);
+      }
+    }
+  }
+
+  if (!orientations_.empty()) {
+    best.orientation = orientations_[best.segment].slerp(bestRatio, orientations_[best.segment + 1]);
+  }
+  return best;
+}
+
+} // namespace wp5_monitoring
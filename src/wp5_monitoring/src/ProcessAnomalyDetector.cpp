@@ -0,0 +1,115 @@
+/**
+ * @file ProcessAnomalyDetector.cpp
+ * @brief Streaming detection of spatter and porosity from the arc electrical data and the melt pool.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include "wp5_monitoring/ProcessAnomalyDetector.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace wp5_monitoring {
+
+namespace {
+
+std::size_t windowSize(const AnomalyDetectorParameters& params) {
+  if (params.sampleRate <= 0.0 || params.window <= 0.0) {
+    throw std::invalid_argument("Sample rate and window must be positive.");
+  }
+  return std::max<std::size_t>(2, static_cast<std::size_t>(std::lround(params.window * params.sampleRate)));
+}
+
+std::size_t frequencyBin(double frequency, const AnomalyDetectorParameters& params) {
+  const std::size_t window = windowSize(params);
+  const double bin = std::round(frequency * window / params.sampleRate);
+  return std::min(window / 2, static_cast<std::size_t>(std::max(0.0, bin)));
+}
+
+} // namespace
+
+ProcessAnomalyDetector::ProcessAnomalyDetector(const AnomalyDetectorParameters& params) :
+    params_(params),
+    current_(windowSize(params)),
+    voltage_(windowSize(params)),
+    shortCircuits_(windowSize(params)),
+    currentSpectrum_(windowSize(params), frequencyBin(params.bandLow, params), frequencyBin(params.bandHigh, params)),
+    meltPoolArea_(params.meltPoolWindow),
+    meltPoolIntensity_(params.meltPoolWindow) {
+  lastAlarm_.fill(-std::numeric_limits<double>::infinity());
+}
+
+void ProcessAnomalyDetector::addArcSample(double current, double voltage) {
+  current_.add(current);
+  voltage_.add(voltage);
+  currentSpectrum_.add(current);
+
+  const bool shorted = voltage < params_.shortCircuitVoltage;
+  shortCircuits_.add(shorted && !shorted_ ? 1.0 : 0.0);
+  shorted_ = shorted;
+}
+
+void ProcessAnomalyDetector::addMeltPool(double time, double area, double intensity) {
+  meltPoolArea_.add(area);
+  meltPoolIntensity_.add(intensity);
+  lastMeltPool_ = time;
+}
+
+ProcessFeatures ProcessAnomalyDetector::evaluate(double time, std::vector<Anomaly>& anomalies) {
+  ProcessFeatures features;
+  features.currentMean = current_.mean();
+  features.currentDeviation = current_.deviation();
+  features.voltageMean = voltage_.mean();
+  features.voltageDeviation = voltage_.deviation();
+  features.spectralRatio = current_.variance() > 0.0 ? currentSpectrum_.bandPower() / current_.variance() : 0.0;
+  features.shortCircuitRate = shortCircuits_.mean() * params_.sampleRate;
+
+  features.meltPoolArea = meltPoolArea_.mean();
+  features.meltPoolVariation = meltPoolArea_.mean() > 0.0 ? meltPoolArea_.deviation() / meltPoolArea_.mean() : 0.0;
+  features.meltPoolIntensity = meltPoolIntensity_.mean();
+
+  if (!current_.full()) {
+    return features;
+  }
+
+  features.spatterScore = std::max(features.shortCircuitRate / params_.maxShortCircuitRate,
+                                   features.spectralRatio / params_.maxSpectralRatio);
+
+  // The melt pool confirms the arc instability when the camera is running
+  const double arcInstability = features.voltageDeviation / params_.maxVoltageDeviation;
+  const bool meltPoolFresh = lastMeltPool_ >= 0.0 && time - lastMeltPool_ <= params_.meltPoolTimeout &&
+                             meltPoolArea_.size() > 1;
+  features.porosityScore =
+      meltPoolFresh ? std::sqrt(arcInstability * features.meltPoolVariation / params_.maxMeltPoolVariation)
+                    : arcInstability;
+
+  auto raise = [&](AnomalyType type, double score) {
+    double& lastAlarm = lastAlarm_[static_cast<std::size_t>(type)];
+    if (score >= 1.0 && time - lastAlarm >= params_.holdTime) {
+      lastAlarm = time;
+      anomalies.push_back(Anomaly{type, time, score});
+    }
+  };
+  raise(AnomalyType::Spatter, features.spatterScore);
+  raise(AnomalyType::Porosity, features.porosityScore);
+
+  return features;
+}
+
+void ProcessAnomalyDetector::reset() {
+  current_.reset();
+  voltage_.reset();
+  shortCircuits_.reset();
+  currentSpectrum_.reset();
+  shorted_ = false;
+  meltPoolArea_.reset();
+  meltPoolIntensity_.reset();
+  lastMeltPool_ = -1.0;
+  lastAlarm_.fill(-std::numeric_limits<double>::infinity());
+}
+
+} // namespace wp5_monitoring
@@ -0,0 +1,124 @@
+/**
+ * @file ProcessAnomalyNodelet.cpp
+ * @brief Streaming anomaly detection on the arc electrical data and the melt pool.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include "wp5_monitoring/ProcessAnomalyNodelet.h"
+
+#include <pluginlib/class_list_macros.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace wp5_monitoring {
+
+void ProcessAnomalyNodelet::onInit() {
+  ros::NodeHandle& nh = getNodeHandle();
+  ros::NodeHandle& pnh = getPrivateNodeHandle();
+
+  AnomalyDetectorParameters params;
+  params.sampleRate = pnh.param("sample_rate", params.sampleRate);
+  params.window = pnh.param("window", params.window);
+  params.bandLow = pnh.param("spectral_band/low", params.bandLow);
+  params.bandHigh = pnh.param("spectral_band/high", params.bandHigh);
+  params.shortCircuitVoltage = pnh.param("short_circuit_voltage", params.shortCircuitVoltage);
+  params.meltPoolWindow = static_cast<std::size_t>(std::max(1, pnh.param("melt_pool/window", 20)));
+  params.meltPoolTimeout = pnh.param("melt_pool/timeout", params.meltPoolTimeout);
+  params.maxShortCircuitRate = pnh.param("spatter/max_short_circuit_rate", params.maxShortCircuitRate);
+  params.maxSpectralRatio = pnh.param("spatter/max_spectral_ratio", params.maxSpectralRatio);
+  params.maxVoltageDeviation = pnh.param("porosity/max_voltage_deviation", params.maxVoltageDeviation);
+  params.maxMeltPoolVariation = pnh.param("porosity/max_melt_pool_variation", params.maxMeltPoolVariation);
+  params.holdTime = pnh.param("hold_time", params.holdTime);
+  detector_ = ProcessAnomalyDetector(params);
+  sampleRate_ = params.sampleRate;
+
+  featuresPeriod_ = 1.0 / std::max(1e-3, pnh.param("features_rate", 100.0));
+
+  anomalyPub_ = nh.advertise<wp5_msgs::ProcessAnomaly>("process_anomaly", 16);
+  featuresPub_ = nh.advertise<wp5_msgs::ProcessFeatures>("process_features", 16);
+
+  arcSamplesLoop_ = &metrics_.loop("arc samples", pnh.param("diagnostics/arc_samples_rate", 0.0));
+  meltPoolLoop_ = &metrics_.loop("melt pool", pnh.param("diagnostics/melt_pool_rate", 0.0));
+  droppedArcSamples_ = &metrics_.drops("arc samples");
+  droppedMeltPools_ = &metrics_.drops("melt pools");
+  metrics_.advertise(nh, pnh, getName(), "Process anomaly");
+
+  arcSamplesSub_ = nh.subscribe(
+      "arc_samples", 64, &ProcessAnomalyNodelet::arcSamplesCallback_, this, ros::TransportHints().tcpNoDelay());
+  meltPoolSub_ = nh.subscribe(
+      "melt_pool", 16, &ProcessAnomalyNodelet::meltPoolCallback_, this, ros::TransportHints().tcpNoDelay());
+}
+
+void ProcessAnomalyNodelet::arcSamplesCallback_(const wp5_msgs::ArcSamplesConstPtr& msg) {
+  arcSamplesLoop_->tick();
+  droppedArcSamples_->addSequenceGap(msg->header.seq);
+
+  if (msg->sample_period > 0.0 && std::abs(msg->sample_period * sampleRate_ - 1.0) > 0.01) {
+    NODELET_WARN_STREAM_THROTTLE(5.0,
+                                 "[ProcessAnomalyNodelet] - Samples received at "
+                                     << 1.0 / msg->sample_period << " Hz, configured for " << sampleRate_ << " Hz.");
+  }
+
+  const std::size_t nbSamples = std::min(msg->current.size(), msg->voltage.size());
+  if (nbSamples == 0) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (std::size_t i = 0; i < nbSamples; ++i) {
+    detector_.addArcSample(msg->current[i], msg->voltage[i]);
+  }
+  evaluate_(msg->header.stamp + ros::Duration((nbSamples - 1) * msg->sample_period));
+}
+
+void ProcessAnomalyNodelet::meltPoolCallback_(const wp5_msgs::MeltPoolConstPtr& msg) {
+  meltPoolLoop_->tick();
+  droppedMeltPools_->addSequenceGap(msg->header.seq);
+
+  if (!msg->valid) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  detector_.addMeltPool(msg->header.stamp.toSec(), msg->area, msg->intensity);
+  evaluate_(msg->header.stamp);
+}
+
+void ProcessAnomalyNodelet::evaluate_(const ros::Time& stamp) {
+  anomalies_.clear();
+  const ProcessFeatures features = detector_.evaluate(stamp.toSec(), anomalies_);
+
+  for (const Anomaly& anomaly : anomalies_) {
+    anomaly_.header.stamp = stamp;
+    anomaly_.type = static_cast<std::uint8_t>(anomaly.type);
+    anomaly_.score = anomaly.score;
+    anomalyPub_.publish(anomaly_);
+  }
+
+  if ((stamp - lastFeatures_).toSec() < featuresPeriod_) {
+    return;
+  }
+  lastFeatures_ = stamp;
+
+  features_.header.stamp = stamp;
+  features_.current_mean = features.currentMean;
+  features_.current_deviation = features.currentDeviation;
+  features_.voltage_mean = features.voltageMean;
+  features_.voltage_deviation = features.voltageDeviation;
+  features_.spectral_ratio = features.spectralRatio;
+  features_.short_circuit_rate = features.shortCircuitRate;
+  features_.melt_pool_area = features.meltPoolArea;
+  features_.melt_pool_variation = features.meltPoolVariation;
+  features_.melt_pool_intensity = features.meltPoolIntensity;
+  features_.spatter_score = features.spatterScore;
+  features_.porosity_score = features.porosityScore;
+  featuresPub_.publish(features_);
+}
+
+} // namespace wp5_monitoring
+
+PLUGINLIB_EXPORT_CLASS(wp5_monitoring::ProcessAnomalyNodelet, nodelet::Nodelet)
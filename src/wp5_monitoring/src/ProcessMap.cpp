@@ -0,0 +1,119 @@
+/**
+ * @file ProcessMap.cpp
+ * @brief Process data indexed by the TCP position, in a sparse voxel hash aligned with the as-built part.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include "wp5_monitoring/ProcessMap.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace wp5_monitoring {
+
+ProcessMap::ProcessMap(double voxelSize, const Eigen::Vector3d& origin) : voxelSize_(voxelSize), origin_(origin) {
+  if (voxelSize_ <= 0.0) {
+    throw std::invalid_argument("Voxel size must be positive.");
+  }
+}
+
+Eigen::Vector3i ProcessMap::index_(const Eigen::Vector3d& position) const {
+  const Eigen::Vector3d scaled = ((position - origin_) / voxelSize_).array().floor();
+  const double bound = static_cast<double>(KEY_OFFSET - 1);
+  return scaled.cwiseMax(-bound).cwiseMin(bound).cast<int>();
+}
+
+ProcessMap::Key ProcessMap::key_(const Eigen::Vector3i& index) {
+  return static_cast<Key>((index.x() + KEY_OFFSET) & KEY_MASK) |
+         static_cast<Key>((index.y() + KEY_OFFSET) & KEY_MASK) << 21 |
+         static_cast<Key>((index.z() + KEY_OFFSET) & KEY_MASK) << 42;
+}
+
+Eigen::Vector3i ProcessMap::unpack_(Key key) {
+  return Eigen::Vector3i(static_cast<int>(static_cast<std::int64_t>(key & KEY_MASK) - KEY_OFFSET),
+                         static_cast<int>(static_cast<std::int64_t>((key >> 21) & KEY_MASK) - KEY_OFFSET),
+                         static_cast<int>(static_cast<std::int64_t>((key >> 42) & KEY_MASK) - KEY_OFFSET));
+}
+
+Eigen::Vector3d ProcessMap::center_(const Eigen::Vector3i& index) const {
+  return origin_ + voxelSize_ * (index.cast<double>() + Eigen::Vector3d::Constant(0.5));
+}
+
+ProcessVoxel& ProcessMap::voxel_(const Eigen::Vector3d& position, double time) {
+  auto [it, created] = voxels_.try_emplace(key_(index_(position)));
+  ProcessVoxel& voxel = it->second;
+  if (created) {
+    voxel.firstTime = time;
+    voxel.lastTime = time;
+  } else {
+    voxel.firstTime = std::min(voxel.firstTime, time);
+    voxel.lastTime = std::max(voxel.lastTime, time);
+  }
+  return voxel;
+}
+
+void ProcessMap::addFeatures(const Eigen::Vector3d& position, double time, const ProcessFeatures& features) {
+  ProcessVoxel& voxel = voxel_(position, time);
+  const double weight = 1.0 / ++voxel.nbSamples;
+  voxel.currentMean += weight * (features.currentMean - voxel.currentMean);
+  voxel.voltageDeviation += weight * (features.voltageDeviation - voxel.voltageDeviation);
+  voxel.meltPoolArea += weight * (features.meltPoolArea - voxel.meltPoolArea);
+  voxel.maxSpatterScore = std::max(voxel.maxSpatterScore, features.spatterScore);
+  voxel.maxPorosityScore = std::max(voxel.maxPorosityScore, features.porosityScore);
+}
+
+void ProcessMap::addDeviation(const Eigen::Vector3d& position, double time, double speedError, double lateralError) {
+  ProcessVoxel& voxel = voxel_(position, time);
+  voxel.speedError += (std::abs(speedError) - voxel.speedError) / ++voxel.nbDeviations;
+  voxel.maxLateralError = std::max(voxel.maxLateralError, std::abs(lateralError));
+}
+
+void ProcessMap::addAnomaly(const Eigen::Vector3d& position, double time, AnomalyType type) {
+  ProcessVoxel& voxel = voxel_(position, time);
+  if (type == AnomalyType::Spatter) {
+    ++voxel.nbSpatter;
+  } else {
+    ++voxel.nbPorosity;
+  }
+}
+
+std::vector<std::pair<Eigen::Vector3d, ProcessVoxel>> ProcessMap::query(const Eigen::Vector3d& min,
+                                                                        const Eigen::Vector3d& max) const {
+  std::vector<std::pair<Eigen::Vector3d, ProcessVoxel>> result;
+  if ((min.array() > max.array()).any() || voxels_.empty()) {
+    return result;
+  }
+
+  const Eigen::Vector3i first = index_(min);
+  const Eigen::Vector3i last = index_(max);
+  const Eigen::Vector3d extent = (last - first).cast<double>() + Eigen::Vector3d::Ones();
+
+  // Small boxes are enumerated voxel by voxel, large ones by a scan of the map
+  if (extent.prod() <= static_cast<double>(voxels_.size())) {
+    for (int z = first.z(); z <= last.z(); ++z) {
+      for (int y = first.y(); y <= last.y(); ++y) {
+        for (int x = first.x(); x <= last.x(); ++x) {
+          const Eigen::Vector3i index(x, y, z);
+          const auto it = voxels_.find(key_(index));
+          if (it != voxels_.end()) {
+            result.emplace_back(center_(index), it->second);
+          }
+        }
+      }
+    }
+    return result;
+  }
+
+  for (const auto& [key, voxel] : voxels_) {
+    const Eigen::Vector3i index = unpack_(key);
+    if ((index.array() >= first.array()).all() && (index.array() <= last.array()).all()) {
+      result.emplace_back(center_(index), voxel);
+    }
+  }
+  return result;
+}
+
+} // namespace wp5_monitoring
@@ -0,0 +1,199 @@
+/**
+ * @file ProcessMapNodelet.cpp
+ * @brief Process data mapped on the part by the TCP position, queryable by region.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include "wp5_monitoring/ProcessMapNodelet.h"
+
+#include <pluginlib/class_list_macros.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace wp5_monitoring {
+
+namespace {
+
+std::vector<double> readVector(const ros::NodeHandle& pnh, const std::string& name, std::size_t size) {
+  std::vector<double> values;
+  if (pnh.getParam(name, values) && values.size() != size) {
+    throw std::invalid_argument("[ProcessMapNodelet] - Parameter " + name + " must have " + std::to_string(size) +
+                                " values.");
+  }
+  return values;
+}
+
+} // namespace
+
+void ProcessMapNodelet::onInit() {
+  ros::NodeHandle& nh = getNodeHandle();
+  ros::NodeHandle& pnh = getPrivateNodeHandle();
+
+  // Same grid as the as-built model, in the frame of the TCP deviations
+  frameId_ = pnh.param<std::string>("frame_id", "positioner_table");
+  const std::vector<double> origin = readVector(pnh, "origin", 3);
+  map_ = ProcessMap(pnh.param("voxel_size", 2e-3),
+                    origin.empty() ? Eigen::Vector3d::Zero() : Eigen::Vector3d(origin[0], origin[1], origin[2]));
+
+  minCurrent_ = pnh.param("min_current", minCurrent_);
+  historyLength_ = pnh.param("history_length", historyLength_);
+  maxGap_ = pnh.param("max_gap", maxGap_);
+
+  historySize_ = &metrics_.gauge("TCP history");
+  unlocatedSamples_ = &metrics_.drops("samples without TCP position");
+  metrics_.advertise(nh, pnh, getName(), "Process map");
+
+  deviationSub_ = nh.subscribe(
+      "tcp_deviation", 64, &ProcessMapNodelet::deviationCallback_, this, ros::TransportHints().tcpNoDelay());
+  featuresSub_ = nh.subscribe("process_features", 64, &ProcessMapNodelet::featuresCallback_, this);
+  anomalySub_ = nh.subscribe("process_anomaly", 16, &ProcessMapNodelet::anomalyCallback_, this);
+
+  queryService_ = nh.advertiseService("query_process_map", &ProcessMapNodelet::queryCallback_, this);
+  resetService_ = nh.advertiseService("process_map/reset", &ProcessMapNodelet::resetCallback_, this);
+}
+
+bool ProcessMapNodelet::positionAt_(const ros::Time& stamp, Eigen::Vector3d& position) const {
+  if (history_.empty()) {
+    return false;
+  }
+
+  // Deviations arrive in order, the history is sorted by stamp
+  auto after = std::lower_bound(history_.begin(),
+                                history_.end(),
+                                stamp,
+                                [](const std::pair<ros::Time, Eigen::Vector3d>& entry, const ros::Time& time) {
+                                  return entry.first < time;
+                                });
+
+  if (after == history_.end()) {
+    position = history_.back().second;
+    return (stamp - history_.back().first).toSec() <= maxGap_;
+  }
+  if (after == history_.begin()) {
+    position = after->second;
+    return (after->first - stamp).toSec() <= maxGap_;
+  }
+
+  const auto before = std::prev(after);
+  const double span = (after->first - before->first).toSec();
+  if (span > 2.0 * maxGap_) {
+    return false;
+  }
+  const double ratio = span > 0.0 ? (stamp - before->first).toSec() / span : 0.0;
+  position = before->second + ratio * (after->second - before->second);
+  return true;
+}
+
+void ProcessMapNodelet::deviationCallback_(const wp5_msgs::TcpDeviationConstPtr& msg) {
+  const Eigen::Vector3d position(msg->position.x, msg->position.y, msg->position.z);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!history_.empty() && msg->header.stamp < history_.back().first) {
+    history_.clear();
+  }
+  history_.emplace_back(msg->header.stamp, position);
+  while ((history_.back().first - history_.front().first).toSec() > historyLength_) {
+    history_.pop_front();
+  }
+  historySize_->set(static_cast<std::int64_t>(history_.size()));
+
+  // TCP deviations only matter while depositing
+  if (arcOn_) {
+    map_.addDeviation(position, msg->header.stamp.toSec(), msg->speed_error, msg->lateral_error);
+  }
+}
+
+void ProcessMapNodelet::featuresCallback_(const wp5_msgs::ProcessFeaturesConstPtr& msg) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  arcOn_ = msg->current_mean >= minCurrent_;
+
+  if (!arcOn_) {
+    return;
+  }
+
+  Eigen::Vector3d position;
+  if (!positionAt_(msg->header.stamp, position)) {
+    unlocatedSamples_->add();
+    return;
+  }
+
+  ProcessFeatures features;
+  features.currentMean = msg->current_mean;
+  features.voltageDeviation = msg->voltage_deviation;
+  features.meltPoolArea = msg->melt_pool_area;
+  features.spatterScore = msg->spatter_score;
+  features.porosityScore = msg->porosity_score;
+  map_.addFeatures(position, msg->header.stamp.toSec(), features);
+}
+
+void ProcessMapNodelet::anomalyCallback_(const wp5_msgs::ProcessAnomalyConstPtr& msg) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  Eigen::Vector3d position;
+  if (!positionAt_(msg->header.stamp, position)) {
+    NODELET_WARN_STREAM_THROTTLE(1.0, "[ProcessMapNodelet] - Anomaly without TCP position, not mapped.");
+    unlocatedSamples_->add();
+    return;
+  }
+
+  const AnomalyType type =
+      msg->type == wp5_msgs::ProcessAnomaly::SPATTER ? AnomalyType::Spatter : AnomalyType::Porosity;
+  map_.addAnomaly(position, msg->header.stamp.toSec(), type);
+}
+
+bool ProcessMapNodelet::queryCallback_(wp5_msgs::QueryProcessMap::Request& req,
+                                       wp5_msgs::QueryProcessMap::Response& res) {
+  const auto start = std::chrono::steady_clock::now();
+  std::vector<std::pair<Eigen::Vector3d, ProcessVoxel>> voxels;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    voxels = map_.query(Eigen::Vector3d(req.min.x, req.min.y, req.min.z),
+                        Eigen::Vector3d(req.max.x, req.max.y, req.max.z));
+    res.voxel_size = map_.getVoxelSize();
+  }
+
+  res.frame_id = frameId_;
+  res.voxels.reserve(voxels.size());
+  for (const auto& [center, voxel] : voxels) {
+    wp5_msgs::ProcessVoxel msg;
+    msg.center.x = center.x();
+    msg.center.y = center.y();
+    msg.center.z = center.z();
+    msg.nb_samples = voxel.nbSamples;
+    msg.current_mean = voxel.currentMean;
+    msg.voltage_deviation = voxel.voltageDeviation;
+    msg.melt_pool_area = voxel.meltPoolArea;
+    msg.max_spatter_score = voxel.maxSpatterScore;
+    msg.max_porosity_score = voxel.maxPorosityScore;
+    msg.nb_deviations = voxel.nbDeviations;
+    msg.speed_error = voxel.speedError;
+    msg.max_lateral_error = voxel.maxLateralError;
+    msg.nb_spatter = voxel.nbSpatter;
+    msg.nb_porosity = voxel.nbPorosity;
+    msg.first_stamp.fromSec(voxel.firstTime);
+    msg.last_stamp.fromSec(voxel.lastTime);
+    res.voxels.push_back(msg);
+  }
+  res.success = true;
+
+  const std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+  NODELET_DEBUG_STREAM("[ProcessMapNodelet] - " << res.voxels.size() << " voxels queried in " << duration.count()
+                                                << " ms.");
+  return true;
+}
+
+bool ProcessMapNodelet::resetCallback_(std_srvs::Empty::Request& /*req*/, std_srvs::Empty::Response& /*res*/) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  map_.clear();
+  return true;
+}
+
+} // namespace wp5_monitoring
+
+PLUGINLIB_EXPORT_CLASS(wp5_monitoring::ProcessMapNodelet, nodelet::Nodelet)
@@ -0,0 +1,109 @@
+/**
+ * @file SlidingWindow.cpp
+ * @brief Statistics and spectrum of a signal over a sliding window, updated in constant time per sample.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include "wp5_monitoring/SlidingWindow.h"
+
+#include <wp5_common/Simd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace wp5_monitoring {
+
+namespace {
+
+// Complex products written out on the interleaved real and imaginary parts, std::complex products check for NaN and
+// do not vectorize
+WP5_TARGET_CLONES
+void updateBins(const double* twiddles, double* bins, std::size_t nbBins, double delta) {
+  for (std::size_t i = 0; i < nbBins; ++i) {
+    const double real = bins[2 * i] + delta;
+    const double imag = bins[2 * i + 1];
+    bins[2 * i] = twiddles[2 * i] * real - twiddles[2 * i + 1] * imag;
+    bins[2 * i + 1] = twiddles[2 * i] * imag + twiddles[2 * i + 1] * real;
+  }
+}
+
+} // namespace
+
+SlidingStatistics::SlidingStatistics(std::size_t window) : values_(std::max<std::size_t>(window, 1), 0.0) {}
+
+void SlidingStatistics::add(double value) {
+  if (!full()) {
+    ++count_;
+    const double delta = value - mean_;
+    mean_ += delta / count_;
+    squares_ += delta * (value - mean_);
+  } else {
+    // Oldest sample replaced, the window size is unchanged
+    const double removed = values_[next_];
+    const double previousMean = mean_;
+    mean_ += (value - removed) / count_;
+    squares_ = std::max(0.0, squares_ + (value - removed) * (value - mean_ + removed - previousMean));
+  }
+
+  values_[next_] = value;
+  next_ = (next_ + 1) % values_.size();
+}
+
+void SlidingStatistics::reset() {
+  next_ = 0;
+  count_ = 0;
+  mean_ = 0.0;
+  squares_ = 0.0;
+}
+
+double SlidingStatistics::deviation() const { return std::sqrt(variance()); }
+
+SlidingDft::SlidingDft(std::size_t window, std::size_t firstBin, std::size_t lastBin) :
+    samples_(window, 0.0), firstBin_(firstBin) {
+  if (window < 2 || firstBin > lastBin || lastBin > window / 2) {
+    throw std::invalid_argument("Monitored bins must be within the first half of a window of at least 2 samples.");
+  }
+
+  dampingWindow_ = std::pow(DAMPING, static_cast<double>(window));
+  for (std::size_t bin = firstBin; bin <= lastBin; ++bin) {
+    twiddles_.push_back(DAMPING * std::polar(1.0, 2.0 * M_PI * bin / window));
+  }
+  bins_.assign(twiddles_.size(), 0.0);
+}
+
+void SlidingDft::add(double value) {
+  // X_k <- r e^(2 i pi k / N) (X_k + x_new - r^N x_old), the window starts filled with zeros
+  const double delta = value - dampingWindow_ * samples_[next_];
+  updateBins(reinterpret_cast<const double*>(twiddles_.data()),
+             reinterpret_cast<double*>(bins_.data()),
+             bins_.size(),
+             delta);
+
+  samples_[next_] = value;
+  next_ = (next_ + 1) % samples_.size();
+  count_ = std::min(count_ + 1, samples_.size());
+}
+
+void SlidingDft::reset() {
+  std::fill(samples_.begin(), samples_.end(), 0.0);
+  std::fill(bins_.begin(), bins_.end(), 0.0);
+  next_ = 0;
+  count_ = 0;
+}
+
+double SlidingDft::bandPower() const {
+  // Parseval, the bins of a real signal appear twice in the spectrum except the constant and the Nyquist ones
+  const double window = static_cast<double>(samples_.size());
+  double power = 0.0;
+  for (std::size_t i = 0; i < bins_.size(); ++i) {
+    const std::size_t bin = firstBin_ + i;
+    const double weight = (bin == 0 || 2 * bin == samples_.size()) ? 1.0 : 2.0;
+    power += weight * std::norm(bins_[i]);
+  }
+  return power / (window * window);
+}
+
+} // namespace wp5_monitoring
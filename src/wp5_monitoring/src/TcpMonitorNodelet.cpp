@@ -0,0 +1,250 @@
+/**
+ * @file TcpMonitorNodelet.cpp
+ * @brief Real-time TCP speed and path deviation monitor, computed from the joint states.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include "wp5_monitoring/TcpMonitorNodelet.h"
+
+#include <pluginlib/class_list_macros.h>
+#include <urdf/model.h>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace wp5_monitoring {
+
+namespace {
+
+// [x, y, z, roll, pitch, yaw] in [m] and [rad], as the fixed transforms of the kinematics of wp5_kinematics
+Eigen::Isometry3d readTransform(const ros::NodeHandle& pnh,
+                                const std::string& name,
+                                const Eigen::Isometry3d& fallback) {
+  std::vector<double> values;
+  if (!pnh.getParam(name, values)) {
+    return fallback;
+  }
+  if (values.size() != 6) {
+    throw std::invalid_argument("[TcpMonitorNodelet] - Parameter " + name + " must have 6 values.");
+  }
+
+  Eigen::Isometry3d transform = Eigen::Isometry3d::Identity();
+  transform.translation() << values[0], values[1], values[2];
+  transform.linear() = (Eigen::AngleAxisd(values[5], Eigen::Vector3d::UnitZ())
+                        * Eigen::AngleAxisd(values[4], Eigen::Vector3d::UnitY())
+                        * Eigen::AngleAxisd(values[3], Eigen::Vector3d::UnitX()))
+                           .toRotationMatrix();
+  return transform;
+}
+
+} // namespace
+
+void TcpMonitorNodelet::onInit() {
+  ros::NodeHandle& nh = getNodeHandle();
+  ros::NodeHandle& pnh = getPrivateNodeHandle();
+
+  std::string description;
+  if (!nh.getParam("robot_description", description)) {
+    throw std::runtime_error("[TcpMonitorNodelet] - Missing robot_description parameter.");
+  }
+
+  referenceFrame_ = pnh.param<std::string>("reference_frame", "positioner_table");
+  const std::string robotBaseFrame = pnh.param<std::string>("robot_base_frame", "base_link");
+  searchWindow_ = static_cast<std::size_t>(std::max(2, pnh.param("search_window", 32)));
+
+  // The description is parsed once, only the generated kinematics and the chain transforms run in the callbacks
+  urdf::Model model;
+  if (!model.initString(description)) {
+    throw std::runtime_error("[TcpMonitorNodelet] - Invalid robot_description.");
+  }
+
+  chainJoints_.assign(Kinematics::JOINT_NAMES.begin(), Kinematics::JOINT_NAMES.end());
+  referenceChain_ = FrameChain(model, referenceFrame_, chainJoints_);
+  baseChain_ = FrameChain(model, robotBaseFrame, chainJoints_);
+  q_.assign(chainJoints_.size(), 0.0);
+  qd_.assign(chainJoints_.size(), 0.0);
+
+  // DH base of ur_description by default, rotated by pi about z from the base link, see config/ur5.yaml of
+  // wp5_kinematics
+  const Eigen::Isometry3d urBase(Eigen::AngleAxisd(M_PI, Eigen::Vector3d::UnitZ()));
+  kinematicsBase_ = readTransform(pnh, "kinematics_base", urBase);
+  tcpOffset_ = readTransform(pnh, "tcp_offset", Eigen::Isometry3d::Identity());
+
+  deviation_.header.frame_id = referenceFrame_;
+
+  jointStatesLoop_ = &metrics_.loop("joint states", pnh.param("diagnostics/nominal_rate", 0.0));
+  droppedJointStates_ = &metrics_.drops("joint states");
+  metrics_.advertise(nh, pnh, getName(), "TCP monitor");
+
+  deviationPub_ = nh.advertise<wp5_msgs::TcpDeviation>("tcp_deviation", 10);
+  plannedTrajectorySub_ =
+      nh.subscribe("planned_trajectory", 1, &TcpMonitorNodelet::plannedTrajectoryCallback_, this);
+  jointStatesSub_ = nh.subscribe(
+      "joint_states", 10, &TcpMonitorNodelet::jointStatesCallback_, this, ros::TransportHints().tcpNoDelay());
+
+  NODELET_INFO_STREAM("[TcpMonitorNodelet] - Monitoring the TCP, " << tcpOffset_.translation().norm()
+                                                                    << " m from the tool frame, in " << referenceFrame_
+                                                                    << " over " << chainJoints_.size() << " joints.");
+}
+
+std::vector<int> TcpMonitorNodelet::mapJoints_(const std::vector<std::string>& names) const {
+  std::vector<int> mapping(names.size(), -1);
+  for (std::size_t i = 0; i < names.size(); ++i) {
+    auto it = std::find(chainJoints_.begin(), chainJoints_.end(), names[i]);
+    if (it != chainJoints_.end()) {
+      mapping[i] = static_cast<int>(std::distance(chainJoints_.begin(), it));
+    }
+  }
+  return mapping;
+}
+
+void TcpMonitorNodelet::plannedTrajectoryCallback_(const trajectory_msgs::JointTrajectoryConstPtr& msg) {
+  const std::vector<int> mapping = mapJoints_(msg->joint_names);
+  if (std::count_if(mapping.begin(), mapping.end(), [](int idx) { return idx >= 0; })
+      != static_cast<long>(chainJoints_.size())) {
+    NODELET_WARN("[TcpMonitorNodelet] - Planned trajectory does not cover the whole chain, missing joints at zero.");
+  }
+
+  // Own copies of the chains, the joint states callback may run concurrently
+  FrameChain referenceChain = referenceChain_;
+  FrameChain baseChain = baseChain_;
+  std::vector<double> q(chainJoints_.size(), 0.0);
+  std::array<double, Kinematics::NB_JOINTS> arm{};
+  wp5_kinematics::Pose<double> armPose;
+
+  std::vector<Eigen::Vector3d> points;
+  std::vector<Eigen::Quaterniond> orientations;
+  std::vector<double> times;
+  points.reserve(msg->points.size());
+  orientations.reserve(msg->points.size());
+  times.reserve(msg->points.size());
+
+  for (const trajectory_msgs::JointTrajectoryPoint& point : msg->points) {
+    for (std::size_t i = 0; i < mapping.size() && i < point.positions.size(); ++i) {
+      if (mapping[i] >= 0) {
+        q[mapping[i]] = point.positions[i];
+      }
+    }
+
+    std::copy_n(q.begin(), Kinematics::NB_JOINTS, arm.begin());
+    Kinematics::forwardKinematics(arm, armPose);
+    const Eigen::Isometry3d tcp = referenceChain.evaluate(q).inverse() * baseChain.evaluate(q) * kinematicsBase_
+                                  * wp5_kinematics::toIsometry(armPose) * tcpOffset_;
+
+    points.push_back(tcp.translation());
+    orientations.emplace_back(tcp.linear());
+    times.push_back(point.time_from_start.toSec());
+  }
+
+  auto path = std::make_shared<const PlannedPath>(std::move(points), times, std::move(orientations));
+
+  std::lock_guard<std::mutex> lock(pathMutex_);
+  path_ = path;
+  lastSegment_ = 0;
+}
+
+void TcpMonitorNodelet::jointStatesCallback_(const sensor_msgs::JointStateConstPtr& msg) {
+  jointStatesLoop_->tick();
+  droppedJointStates_->addSequenceGap(msg->header.seq);
+
+  if (msg->name != stateNames_) {
+    stateNames_ = msg->name;
+    stateMapping_ = mapJoints_(stateNames_);
+  }
+
+  const bool hasVelocities = msg->velocity.size() == msg->name.size();
+  for (std::size_t i = 0; i < stateMapping_.size() && i < msg->position.size(); ++i) {
+    if (stateMapping_[i] >= 0) {
+      q_[stateMapping_[i]] = msg->position[i];
+      qd_[stateMapping_[i]] = hasVelocities ? msg->velocity[i] : 0.0;
+    }
+  }
+
+  std::copy_n(q_.begin(), Kinematics::NB_JOINTS, armPositions_.begin());
+  if (hasVelocities) {
+    Kinematics::jacobian(armPositions_, armPose_, armJacobian_);
+  } else {
+    Kinematics::forwardKinematics(armPositions_, armPose_);
+  }
+
+  const Eigen::Isometry3d& rootReference = referenceChain_.evaluate(q_);
+  const Eigen::Isometry3d rootBase = baseChain_.evaluate(q_) * kinematicsBase_;
+  const Eigen::Isometry3d tool = wp5_kinematics::toIsometry(armPose_);
+  const Eigen::Isometry3d rootTcp = rootBase * tool * tcpOffset_;
+  const Eigen::Isometry3d tcp = rootReference.inverse() * rootTcp;
+  const Eigen::Vector3d position = tcp.translation();
+
+  // TCP velocity relative to the reference frame from the Jacobians when the driver reports joint velocities, finite
+  // differences otherwise
+  Eigen::Vector3d velocity = Eigen::Vector3d::Zero();
+  if (hasVelocities) {
+    // The Jacobian is at the tool frame, the TCP adds the lever arm of its offset
+    const Eigen::Matrix<double, 6, 1> toolTwist =
+        wp5_kinematics::toMatrix(armJacobian_)
+        * Eigen::Map<const Eigen::Matrix<double, Kinematics::NB_JOINTS, 1>>(qd_.data());
+    const Eigen::Vector3d armVelocity =
+        toolTwist.head<3>() + toolTwist.tail<3>().cross(tool.linear() * tcpOffset_.translation());
+    velocity = rootReference.linear().transpose()
+               * (rootBase.linear() * armVelocity + baseChain_.pointVelocity(rootTcp.translation(), qd_)
+                  - referenceChain_.pointVelocity(rootTcp.translation(), qd_));
+  } else if (hasPrevious_ && msg->header.stamp > previousStamp_) {
+    velocity = (position - previousPosition_) / (msg->header.stamp - previousStamp_).toSec();
+  }
+
+  hasPrevious_ = true;
+  previousStamp_ = msg->header.stamp;
+  previousPosition_ = position;
+
+  std::shared_ptr<const PlannedPath> path;
+  std::size_t hint = 0;
+  {
+    std::lock_guard<std::mutex> lock(pathMutex_);
+    path = path_;
+    hint = lastSegment_;
+  }
+
+  if (!path || path->size() < 2) {
+    return;
+  }
+
+  const PlannedPath::Projection projection = path->project(position, hint, searchWindow_);
+  {
+    std::lock_guard<std::mutex> lock(pathMutex_);
+    if (path == path_) {
+      lastSegment_ = projection.segment;
+    }
+  }
+
+  // Lateral is horizontal and normal to the path, vertical along the reference z axis
+  const Eigen::Vector3d error = position - projection.closest;
+  Eigen::Vector3d lateralAxis = Eigen::Vector3d::UnitZ().cross(projection.tangent);
+  if (lateralAxis.squaredNorm() < 1e-12) {
+    lateralAxis = projection.tangent.unitOrthogonal();
+  }
+  lateralAxis.normalize();
+
+  // Angle of the rotation from the planned to the measured tool orientation, in [0, pi]
+  const Eigen::AngleAxisd orientationError(projection.orientation.conjugate() * Eigen::Quaterniond(tcp.linear()));
+
+  deviation_.header.stamp = msg->header.stamp;
+  deviation_.position.x = position.x();
+  deviation_.position.y = position.y();
+  deviation_.position.z = position.z();
+  deviation_.speed = velocity.norm();
+  deviation_.segment_index = static_cast<std::uint32_t>(projection.segment);
+  deviation_.path_position = projection.pathPosition;
+  deviation_.planned_speed = projection.plannedSpeed;
+  deviation_.lateral_error = error.dot(lateralAxis);
+  deviation_.vertical_error = error.z();
+  deviation_.speed_error = deviation_.speed - deviation_.planned_speed;
+  deviation_.orientation_error = orientationError.angle();
+
+  deviationPub_.publish(deviation_);
+}
+
+} // namespace wp5_monitoring
+
+PLUGINLIB_EXPORT_CLASS(wp5_monitoring::TcpMonitorNodelet, nodelet::Nodelet)
@@ -0,0 +1,121 @@
+/**
+ * @file CoordinatedIkSolver.h
+ * @brief Inverse kinematics over the extended robot + positioner chain.
+ *
+ * The positioner axes are treated as additional joints of the planning group: the chain goes from the part frame,
+ * down through the positioner to the world, then up through the arm to the tool. Waypoints are expressed in the part
+ * frame, so any positioner configuration that keeps the tool on the waypoint is valid. The remaining redundancy is
+ * used to keep the deposition direction aligned with gravity, as a soft objective projected in the null space of the
+ * tracking task.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <kdl/chain.hpp>
+#include <kdl/frames.hpp>
+
+#include <Eigen/Geometry>
+#include <string>
+#include <vector>
+
+namespace wp5_planner {
+
+struct CoordinatedIkParameters {
+  int maxIterations = 100;
+  double positionTolerance = 1e-4;    // [m]
+  double orientationTolerance = 1e-3; // [rad]
+  double damping = 1e-2;
+  double maxStep = 0.2; // [rad] maximum joint step norm per iteration
+
+  double gravityWeight = 0.5;              // Weight of the gravity-aligned deposition objective, 0 disables it
+  Eigen::Vector3d gravity{0.0, 0.0, -1.0}; // Gravity direction in world frame
+  Eigen::Vector3d toolAxis{0.0, 0.0, 1.0}; // Deposition direction in tool frame
+
+  std::size_t coarseStride = 16; // Every n-th waypoint is solved sequentially to seed the parallel pass
+  std::size_t nbThreads = 0;     // Threads of the shared task scheduler, 0 uses all of them
+};
+
+struct IkResult {
+  bool success = false;
+  Eigen::VectorXd joints;
+  double positionError = 0.0;
+  double orientationError = 0.0;
+  double gravityMisalignment = 0.0; // Angle between the deposition direction and gravity [rad]
+};
+
+class CoordinatedIkSolver {
+public:
+  /**
+   * @brief Build the extended kinematic model from the cell URDF.
+   *
+   * @param urdf Cell description containing both the arm and the positioner.
+   * @param worldFrame Common root of the arm and the positioner.
+   * @param partFrame Frame carried by the positioner in which the waypoints are expressed.
+   * @param toolFrame Tool center point of the arm.
+   * @param params Solver parameters.
+   */
+  CoordinatedIkSolver(const std::string& urdf,
+                      const std::string& worldFrame,
+                      const std::string& partFrame,
+                      const std::string& toolFrame,
+                      const CoordinatedIkParameters& params = CoordinatedIkParameters());
+
+  const std::vector<std::string>& getJointNames() const { return jointNames_; }
+  const Eigen::VectorXd& getLowerLimits() const { return lowerLimits_; }
+  const Eigen::VectorXd& getUpperLimits() const { return upperLimits_; }
+  const Eigen::VectorXd& getVelocityLimits() const { return velocityLimits_; }
+  std::size_t getNbJoints() const { return jointNames_.size(); }
+
+  /**
+   * @brief Solve a single waypoint, expressed in the part frame.
+   */
+  IkResult solve(const Eigen::Isometry3d& target, const Eigen::VectorXd& seed) const;
+
+  /**
+   * @brief Solve a whole layer at once.
+   *
+   * Every coarseStride-th waypoint is solved sequentially from the seed to keep the solution branch continuous, then
+   * the waypoints in between are solved in parallel, each chunk being warm started from its coarse solution.
+   */
+  std::vector<IkResult> solveBatch(const std::vector<Eigen::Isometry3d>& targets, const Eigen::VectorXd& seed) const;
+
+  /**
+   * @brief Solve a whole layer warm started from the solution of a layer of the same shape, one seed per waypoint.
+   *
+   * The seeds already lie on one solution branch, so every waypoint is solved in parallel. Throws
+   * std::invalid_argument when there is not one seed per waypoint.
+   */
+  std::vector<IkResult> solveBatch(const std::vector<Eigen::Isometry3d>& targets,
+                                   const std::vector<Eigen::VectorXd>& seeds) const;
+
+  /**
+   * @brief Pose of the tool in the part frame for the given joint configuration.
+   */
+  Eigen::Isometry3d computeToolPose(const Eigen::VectorXd& joints) const;
+
+private:
+  struct Workspace;
+
+  void solveRange_(const std::vector<Eigen::Isometry3d>& targets,
+                   std::size_t begin,
+                   std::size_t end,
+                   const Eigen::VectorXd& seed,
+                   std::vector<IkResult>& results) const;
+  IkResult solve_(Workspace& ws, const Eigen::Isometry3d& target, const Eigen::VectorXd& seed) const;
+
+  CoordinatedIkParameters params_;
+
+  KDL::Chain extendedChain_;   // Part frame -> positioner -> world -> arm -> tool
+  KDL::Chain positionerChain_; // World -> positioner -> part frame
+
+  std::vector<std::string> jointNames_;
+  std::vector<int> positionerIndices_; // Index in the extended chain of each positioner chain joint
+  Eigen::VectorXd lowerLimits_;
+  Eigen::VectorXd upperLimits_;
+  Eigen::VectorXd velocityLimits_;
+};
+
+} // namespace wp5_planner
@@ -0,0 +1,104 @@
+/**
+ * @file TrajectoryCache.h
+ * @brief Cache of planned and parameterized layer trajectories, keyed by the layer geometry.
+ *
+ * Repeated layers (prismatic walls, several identical parts) share their shape, only shifted along the build direction.
+ * The key hashes the waypoints relative to the first one, the start state quantized coarsely, as it only picks the IK
+ * branch, and the planner context, so the layers of a wall share one key. Each entry keeps the first waypoint it was
+ * planned from: at the same place a hit skips IK and timing entirely, elsewhere its joints warm start the IK. Entries
+ * live in a small in-memory LRU and are persisted on disk, one serialized trajectory per file, so they survive restarts
+ * of the planner.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <trajectory_msgs/JointTrajectory.h>
+
+#include <Eigen/Geometry>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace wp5_planner {
+
+class TrajectoryCache {
+public:
+  struct Entry {
+    trajectory_msgs::JointTrajectory trajectory;
+    Eigen::Vector3d origin = Eigen::Vector3d::Zero(); // First waypoint the trajectory was planned from
+  };
+
+  struct Key {
+    std::uint64_t high = 0;
+    std::uint64_t low = 0;
+
+    bool operator==(const Key& other) const { return high == other.high && low == other.low; }
+    std::string toString() const;
+  };
+
+  /**
+   * @param directory Disk store, created if missing. Empty keeps the cache in memory only.
+   * @param maxMemoryEntries Number of trajectories kept in memory.
+   * @param resolution Quantization step applied to the relative waypoints and the speed before hashing [m, rad].
+   * @param startResolution Quantization step applied to the start state before hashing [rad].
+   * @throws std::invalid_argument if a resolution is not strictly positive.
+   */
+  TrajectoryCache(const std::string& directory,
+                  std::size_t maxMemoryEntries,
+                  double resolution = 1e-6,
+                  double startResolution = 0.05);
+
+  /**
+   * @brief Hash arbitrary planner context (cell description, parameters) into a seed for computeKey.
+   */
+  static std::uint64_t hashContext(const std::string& context);
+
+  Key computeKey(const std::vector<Eigen::Isometry3d>& waypoints,
+                 const Eigen::VectorXd& startState,
+                 double depositionSpeed,
+                 std::uint64_t contextSeed) const;
+
+  std::optional<Entry> find(const Key& key);
+  void store(const Key& key, const Entry& entry);
+
+  /**
+   * @brief Whether an entry was planned from this first waypoint, its trajectory then reused as is.
+   */
+  bool isSameOrigin(const Entry& entry, const Eigen::Vector3d& origin) const {
+    return (entry.origin - origin).cwiseAbs().maxCoeff() <= resolution_;
+  }
+
+  std::size_t getHits() const { return hits_; }
+  std::size_t getMisses() const { return misses_; }
+
+private:
+  struct KeyHash {
+    std::size_t operator()(const Key& key) const { return static_cast<std::size_t>(key.low); }
+  };
+  using LruList = std::list<std::pair<Key, Entry>>;
+
+  void insertMemory_(const Key& key, const Entry& entry);
+  std::string filePath_(const Key& key) const;
+  bool readFile_(const Key& key, Entry& entry) const;
+  void writeFile_(const Key& key, const Entry& entry) const;
+
+  std::string directory_;
+  std::size_t maxMemoryEntries_;
+  double resolution_;
+  double startResolution_;
+
+  std::mutex mutex_;
+  LruList lru_;
+  std::unordered_map<Key, LruList::iterator, KeyHash> index_;
+  std::size_t hits_ = 0;
+  std::size_t misses_ = 0;
+};
+
+} // namespace wp5_planner
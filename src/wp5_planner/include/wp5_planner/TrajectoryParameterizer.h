@@ -0,0 +1,39 @@
+/**
+ * @file TrajectoryParameterizer.h
+ * @brief Time parameterization of a layer planned in joint space.
+ *
+ * The deposition speed is defined relative to the part, each segment lasts as long as needed to travel it at that
+ * speed, stretched when a joint would otherwise exceed its velocity limit.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <trajectory_msgs/JointTrajectory.h>
+
+#include <Eigen/Geometry>
+#include <string>
+#include <vector>
+
+namespace wp5_planner {
+
+/**
+ * @brief Build a timed joint trajectory from the layer waypoints and their IK solutions.
+ *
+ * @param waypoints Layer waypoints, in the part frame.
+ * @param joints IK solution of each waypoint, same size as waypoints.
+ * @param jointNames Names of the joints, in the same order as the solutions.
+ * @param velocityLimits Joint velocity limits [rad/s].
+ * @param depositionSpeed TCP speed relative to the part [m/s].
+ * @param velocityScaling Fraction of the joint velocity limits allowed, in ]0, 1].
+ */
+trajectory_msgs::JointTrajectory parameterizeTrajectory(const std::vector<Eigen::Isometry3d>& waypoints,
+                                                        const std::vector<Eigen::VectorXd>& joints,
+                                                        const std::vector<std::string>& jointNames,
+                                                        const Eigen::VectorXd& velocityLimits,
+                                                        double depositionSpeed,
+                                                        double velocityScaling = 1.0);
+
+} // namespace wp5_planner
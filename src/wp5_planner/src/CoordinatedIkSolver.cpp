@@ -0,0 +1,330 @@
+/**
+ * @file CoordinatedIkSolver.cpp
+ * @brief Inverse kinematics over the extended robot + positioner chain.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include "wp5_planner/CoordinatedIkSolver.h"
+
+#include <kdl/chainfksolverpos_recursive.hpp>
+#include <kdl/chainjnttojacsolver.hpp>
+#include <kdl/jacobian.hpp>
+#include <kdl/jntarray.hpp>
+#include <kdl_parser/kdl_parser.hpp>
+#include <urdf/model.h>
+#include <wp5_common/TaskScheduler.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace wp5_planner {
+
+namespace {
+
+Eigen::Isometry3d toEigen(const KDL::Frame& frame) {
+  Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();
+  for (int r = 0; r < 3; ++r) {
+    for (int c = 0; c < 3; ++c) {
+      pose.linear()(r, c) = frame.M(r, c);
+    }
+  }
+  pose.translation() = Eigen::Vector3d(frame.p.x(), frame.p.y(), frame.p.z());
+  return pose;
+}
+
+} // namespace
+
+// Per-thread solvers and buffers, KDL solvers are not safe to share between threads.
+struct CoordinatedIkSolver::Workspace {
+  Workspace(const KDL::Chain& extended, const KDL::Chain& positioner) :
+      fkExtended(extended),
+      jacExtended(extended),
+      fkPositioner(positioner),
+      jacPositioner(positioner),
+      q(extended.getNrOfJoints()),
+      qPositioner(positioner.getNrOfJoints()),
+      jacobian(extended.getNrOfJoints()),
+      jacobianPositioner(positioner.getNrOfJoints()) {}
+
+  KDL::ChainFkSolverPos_recursive fkExtended;
+  KDL::ChainJntToJacSolver jacExtended;
+  KDL::ChainFkSolverPos_recursive fkPositioner;
+  KDL::ChainJntToJacSolver jacPositioner;
+
+  KDL::JntArray q;
+  KDL::JntArray qPositioner;
+  KDL::Jacobian jacobian;
+  KDL::Jacobian jacobianPositioner;
+};
+
+CoordinatedIkSolver::CoordinatedIkSolver(const std::string& urdf,
+                                         const std::string& worldFrame,
+                                         const std::string& partFrame,
+                                         const std::string& toolFrame,
+                                         const CoordinatedIkParameters& params) :
+    params_(params) {
+  KDL::Tree tree;
+  if (!kdl_parser::treeFromString(urdf, tree)) {
+    throw std::runtime_error("[CoordinatedIkSolver] - Failed to parse the cell description.");
+  }
+
+  // KDL reverses the positioner joints when walking from the part frame down to the world
+  if (!tree.getChain(partFrame, toolFrame, extendedChain_)) {
+    throw std::runtime_error("[CoordinatedIkSolver] - No chain from " + partFrame + " to " + toolFrame + ".");
+  }
+  if (!tree.getChain(worldFrame, partFrame, positionerChain_)) {
+    throw std::runtime_error("[CoordinatedIkSolver] - No chain from " + worldFrame + " to " + partFrame + ".");
+  }
+
+  urdf::Model model;
+  if (!model.initString(urdf)) {
+    throw std::runtime_error("[CoordinatedIkSolver] - Failed to parse the joint limits.");
+  }
+
+  const std::size_t nbJoints = extendedChain_.getNrOfJoints();
+  lowerLimits_.resize(nbJoints);
+  upperLimits_.resize(nbJoints);
+  velocityLimits_.resize(nbJoints);
+
+  for (const KDL::Segment& segment : extendedChain_.segments) {
+    if (segment.getJoint().getType() == KDL::Joint::None) {
+      continue;
+    }
+
+    const std::string& name = segment.getJoint().getName();
+    const std::size_t idx = jointNames_.size();
+    jointNames_.push_back(name);
+
+    lowerLimits_[idx] = -std::numeric_limits<double>::infinity();
+    upperLimits_[idx] = std::numeric_limits<double>::infinity();
+    velocityLimits_[idx] = std::numeric_limits<double>::infinity();
+
+    const urdf::JointConstSharedPtr joint = model.getJoint(name);
+    if (joint && joint->limits) {
+      if (joint->type != urdf::Joint::CONTINUOUS) {
+        lowerLimits_[idx] = joint->limits->lower;
+        upperLimits_[idx] = joint->limits->upper;
+      }
+      if (joint->limits->velocity > 0.0) {
+        velocityLimits_[idx] = joint->limits->velocity;
+      }
+    }
+  }
+
+  for (const KDL::Segment& segment : positionerChain_.segments) {
+    if (segment.getJoint().getType() == KDL::Joint::None) {
+      continue;
+    }
+
+    auto it = std::find(jointNames_.begin(), jointNames_.end(), segment.getJoint().getName());
+    if (it == jointNames_.end()) {
+      throw std::runtime_error("[CoordinatedIkSolver] - Positioner joint " + segment.getJoint().getName()
+                               + " missing from the extended chain.");
+    }
+    positionerIndices_.push_back(static_cast<int>(std::distance(jointNames_.begin(), it)));
+  }
+
+  params_.gravity.normalize();
+  params_.toolAxis.normalize();
+}
+
+Eigen::Isometry3d CoordinatedIkSolver::computeToolPose(const Eigen::VectorXd& joints) const {
+  KDL::ChainFkSolverPos_recursive fk(extendedChain_);
+  KDL::JntArray q(extendedChain_.getNrOfJoints());
+  q.data = joints;
+
+  KDL::Frame frame;
+  fk.JntToCart(q, frame);
+  return toEigen(frame);
+}
+
+IkResult CoordinatedIkSolver::solve(const Eigen::Isometry3d& target, const Eigen::VectorXd& seed) const {
+  Workspace ws(extendedChain_, positionerChain_);
+  return solve_(ws, target, seed);
+}
+
+std::vector<IkResult> CoordinatedIkSolver::solveBatch(const std::vector<Eigen::Isometry3d>& targets,
+                                                      const Eigen::VectorXd& seed) const {
+  std::vector<IkResult> results(targets.size());
+  if (targets.empty()) {
+    return results;
+  }
+
+  const std::size_t stride = std::max<std::size_t>(1, params_.coarseStride);
+
+  // Coarse pass, sequential to stay on the same solution branch along the layer
+  std::vector<std::size_t> anchors;
+  for (std::size_t i = 0; i < targets.size(); i += stride) {
+    anchors.push_back(i);
+  }
+
+  Workspace ws(extendedChain_, positionerChain_);
+  Eigen::VectorXd currentSeed = seed;
+  for (std::size_t anchor : anchors) {
+    results[anchor] = solve_(ws, targets[anchor], currentSeed);
+    currentSeed = results[anchor].joints;
+  }
+
+  // Fill pass, each chunk between two anchors is independent
+  wp5_common::TaskScheduler::instance().parallelFor(
+      0,
+      anchors.size(),
+      [&](std::size_t chunk) {
+        const std::size_t begin = anchors[chunk] + 1;
+        const std::size_t end = std::min(anchors[chunk] + stride, targets.size());
+        solveRange_(targets, begin, end, results[anchors[chunk]].joints, results);
+      },
+      params_.nbThreads);
+
+  return results;
+}
+
+std::vector<IkResult> CoordinatedIkSolver::solveBatch(const std::vector<Eigen::Isometry3d>& targets,
+                                                      const std::vector<Eigen::VectorXd>& seeds) const {
+  if (seeds.size() != targets.size()) {
+    throw std::invalid_argument("[CoordinatedIkSolver] - " + std::to_string(seeds.size()) + " seeds for "
+                                + std::to_string(targets.size()) + " waypoints.");
+  }
+
+  std::vector<IkResult> results(targets.size());
+  const std::size_t stride = std::max<std::size_t>(1, params_.coarseStride);
+  const std::size_t nbChunks = (targets.size() + stride - 1) / stride;
+
+  // Chunks of the coarse stride, one workspace for each
+  wp5_common::TaskScheduler::instance().parallelFor(
+      0,
+      nbChunks,
+      [&](std::size_t chunk) {
+        Workspace ws(extendedChain_, positionerChain_);
+        const std::size_t end = std::min((chunk + 1) * stride, targets.size());
+        for (std::size_t i = chunk * stride; i < end; ++i) {
+          results[i] = solve_(ws, targets[i], seeds[i]);
+        }
+      },
+      params_.nbThreads);
+
+  return results;
+}
+
+void CoordinatedIkSolver::solveRange_(const std::vector<Eigen::Isometry3d>& targets,
+                                      std::size_t begin,
+                                      std::size_t end,
+                                      const Eigen::VectorXd& seed,
+                                      std::vector<IkResult>& results) const {
+  Workspace ws(extendedChain_, positionerChain_);
+  const Eigen::VectorXd* currentSeed = &seed;
+
+  for (std::size_t i = begin; i < end; ++i) {
+    results[i] = solve_(ws, targets[i], *currentSeed);
+    currentSeed = &results[i].joints;
+  }
+}
+
+IkResult CoordinatedIkSolver::solve_(Workspace& ws,
+                                     const Eigen::Isometry3d& target,
+                                     const Eigen::VectorXd& seed) const {
+  const std::size_t nbJoints = getNbJoints();
+  const double damping2 = params_.damping * params_.damping;
+
+  ws.q.data = seed.cwiseMax(lowerLimits_).cwiseMin(upperLimits_);
+
+  Eigen::Matrix<double, 6, 1> error;
+  Eigen::MatrixXd pinv(nbJoints, 6);
+  Eigen::MatrixXd nullspace(nbJoints, nbJoints);
+  Eigen::Matrix3d worldRotPart;
+  Eigen::MatrixXd gravityJacobian(3, nbJoints);
+  Eigen::VectorXd step(nbJoints);
+
+  IkResult result;
+  KDL::Frame frame;
+
+  auto evaluate = [&]() {
+    ws.fkExtended.JntToCart(ws.q, frame);
+    const Eigen::Isometry3d current = toEigen(frame);
+    const Eigen::AngleAxisd rotError(target.linear() * current.linear().transpose());
+
+    error.head<3>() = target.translation() - current.translation();
+    error.tail<3>() = rotError.angle() * rotError.axis();
+
+    result.positionError = error.head<3>().norm();
+    result.orientationError = std::abs(rotError.angle());
+    return current;
+  };
+
+  for (int iter = 0; iter < params_.maxIterations; ++iter) {
+    const Eigen::Isometry3d current = evaluate();
+    const bool tracking = result.positionError < params_.positionTolerance
+                          && result.orientationError < params_.orientationTolerance;
+
+    ws.jacExtended.JntToJac(ws.q, ws.jacobian);
+    const auto& jac = ws.jacobian.data;
+
+    // Damped least squares on the tracking task
+    Eigen::Matrix<double, 6, 6> jjt = jac * jac.transpose();
+    jjt.diagonal().array() += damping2;
+    pinv = jac.transpose() * jjt.ldlt().solve(Eigen::Matrix<double, 6, 6>::Identity());
+    step = pinv * error;
+
+    // Gravity-aligned deposition, projected in the null space of the tracking task
+    double secondaryStep = 0.0;
+    if (params_.gravityWeight > 0.0) {
+      for (std::size_t k = 0; k < positionerIndices_.size(); ++k) {
+        ws.qPositioner(k) = ws.q(positionerIndices_[k]);
+      }
+
+      KDL::Frame partFrame;
+      ws.fkPositioner.JntToCart(ws.qPositioner, partFrame);
+      ws.jacPositioner.JntToJac(ws.qPositioner, ws.jacobianPositioner);
+      worldRotPart = toEigen(partFrame).linear();
+
+      const Eigen::Vector3d depositionDir = worldRotPart * current.linear() * params_.toolAxis;
+      const Eigen::Vector3d gravityError = depositionDir.cross(params_.gravity);
+
+      // Angular velocity of the tool in world = part rotation + tool rotation relative to the part
+      gravityJacobian = worldRotPart * jac.bottomRows<3>();
+      for (std::size_t k = 0; k < positionerIndices_.size(); ++k) {
+        gravityJacobian.col(positionerIndices_[k]) += ws.jacobianPositioner.data.block<3, 1>(3, k);
+      }
+
+      nullspace = Eigen::MatrixXd::Identity(nbJoints, nbJoints) - pinv * jac;
+      const Eigen::VectorXd secondary =
+          nullspace * (params_.gravityWeight * gravityJacobian.transpose() * gravityError);
+      step += secondary;
+      secondaryStep = secondary.norm();
+    }
+
+    if (tracking && secondaryStep < params_.positionTolerance) {
+      break;
+    }
+
+    const double stepNorm = step.norm();
+    if (stepNorm > params_.maxStep) {
+      step *= params_.maxStep / stepNorm;
+    }
+
+    ws.q.data = (ws.q.data + step).cwiseMax(lowerLimits_).cwiseMin(upperLimits_);
+  }
+
+  const Eigen::Isometry3d current = evaluate();
+  result.success = result.positionError < params_.positionTolerance
+                   && result.orientationError < params_.orientationTolerance;
+  result.joints = ws.q.data;
+
+  for (std::size_t k = 0; k < positionerIndices_.size(); ++k) {
+    ws.qPositioner(k) = ws.q(positionerIndices_[k]);
+  }
+  KDL::Frame partFrame;
+  ws.fkPositioner.JntToCart(ws.qPositioner, partFrame);
+
+  const Eigen::Vector3d depositionDir = toEigen(partFrame).linear() * current.linear() * params_.toolAxis;
+  result.gravityMisalignment = std::acos(std::clamp(depositionDir.dot(params_.gravity), -1.0, 1.0));
+
+  return result;
+}
+
+} // namespace wp5_planner
@@ -0,0 +1,264 @@
+/**
+ * @file TrajectoryCache.cpp
+ * @brief Cache of planned and parameterized layer trajectories, keyed by the layer geometry.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include "wp5_planner/TrajectoryCache.h"
+
+#include <ros/console.h>
+#include <ros/serialization.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+
+namespace wp5_planner {
+
+namespace {
+
+// Version of the entry layout, entries of another layout are ignored
+constexpr char FILE_MAGIC[4] = {'W', 'P', '5', 'R'};
+
+std::uint64_t mix(std::uint64_t x) {
+  x ^= x >> 30;
+  x *= 0xbf58476d1ce4e5b9ULL;
+  x ^= x >> 27;
+  x *= 0x94d049bb133111ebULL;
+  x ^= x >> 31;
+  return x;
+}
+
+// Two independent 64 bits lanes, collisions between distinct layers are not a practical concern at 128 bits
+class Hasher {
+public:
+  explicit Hasher(std::uint64_t seed) :
+      high_(mix(seed ^ 0x9e3779b97f4a7c15ULL)), low_(mix(seed + 0xc2b2ae3d27d4eb4fULL)) {}
+
+  void add(std::uint64_t word) {
+    high_ = mix(high_ ^ word);
+    low_ = mix(low_ + word + 0x165667b19e3779f9ULL);
+    ++count_;
+  }
+
+  TrajectoryCache::Key finalize() const { return {mix(high_ ^ count_), mix(low_ + count_)}; }
+
+private:
+  std::uint64_t high_;
+  std::uint64_t low_;
+  std::uint64_t count_ = 0;
+};
+
+} // namespace
+
+std::string TrajectoryCache::Key::toString() const {
+  std::ostringstream oss;
+  oss << std::hex << std::setfill('0') << std::setw(16) << high << std::setw(16) << low;
+  return oss.str();
+}
+
+TrajectoryCache::TrajectoryCache(const std::string& directory,
+                                 std::size_t maxMemoryEntries,
+                                 double resolution,
+                                 double startResolution) :
+    directory_(directory),
+    maxMemoryEntries_(std::max<std::size_t>(1, maxMemoryEntries)),
+    resolution_(resolution),
+    startResolution_(startResolution) {
+  // Negated, so that NaN is rejected as well
+  if (!(resolution_ > 0.0) || !(startResolution_ > 0.0)) {
+    throw std::invalid_argument("[TrajectoryCache] - Resolutions must be strictly positive, got "
+                                + std::to_string(resolution_) + " and " + std::to_string(startResolution_) + ".");
+  }
+
+  if (!directory_.empty()) {
+    std::error_code ec;
+    std::filesystem::create_directories(directory_, ec);
+    if (ec) {
+      ROS_WARN_STREAM("[TrajectoryCache] - Cannot create " << directory_ << ", cache kept in memory: " << ec.message());
+      directory_.clear();
+    }
+  }
+}
+
+std::uint64_t TrajectoryCache::hashContext(const std::string& context) {
+  Hasher hasher(context.size());
+  for (std::size_t i = 0; i < context.size(); i += sizeof(std::uint64_t)) {
+    std::uint64_t word = 0;
+    std::memcpy(&word, context.data() + i, std::min(sizeof(word), context.size() - i));
+    hasher.add(word);
+  }
+  return hasher.finalize().low;
+}
+
+TrajectoryCache::Key TrajectoryCache::computeKey(const std::vector<Eigen::Isometry3d>& waypoints,
+                                                 const Eigen::VectorXd& startState,
+                                                 double depositionSpeed,
+                                                 std::uint64_t contextSeed) const {
+  auto quantize = [](double value, double resolution) {
+    return static_cast<std::uint64_t>(std::llround(value / resolution));
+  };
+
+  // Relative to the first waypoint, so that the layers of a wall share the key whatever their height
+  const Eigen::Vector3d origin =
+      waypoints.empty() ? Eigen::Vector3d::Zero().eval() : Eigen::Vector3d(waypoints.front().translation());
+
+  Hasher hasher(contextSeed);
+  hasher.add(waypoints.size());
+  for (const Eigen::Isometry3d& waypoint : waypoints) {
+    const Eigen::Vector3d p = waypoint.translation() - origin;
+    Eigen::Quaterniond q(waypoint.linear());
+
+    // q and -q are the same orientation
+    if (q.w() < 0.0) {
+      q.coeffs() = -q.coeffs();
+    }
+
+    hasher.add(quantize(p.x(), resolution_));
+    hasher.add(quantize(p.y(), resolution_));
+    hasher.add(quantize(p.z(), resolution_));
+    hasher.add(quantize(q.x(), resolution_));
+    hasher.add(quantize(q.y(), resolution_));
+    hasher.add(quantize(q.z(), resolution_));
+    hasher.add(quantize(q.w(), resolution_));
+  }
+
+  // The start state only seeds the IK, joints within the same step land on the same solution branch
+  hasher.add(startState.size());
+  for (Eigen::Index i = 0; i < startState.size(); ++i) {
+    hasher.add(quantize(startState[i], startResolution_));
+  }
+
+  hasher.add(quantize(depositionSpeed, resolution_));
+  return hasher.finalize();
+}
+
+std::optional<TrajectoryCache::Entry> TrajectoryCache::find(const Key& key) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+      lru_.splice(lru_.begin(), lru_, it->second);
+      ++hits_;
+      return it->second->second;
+    }
+  }
+
+  Entry entry;
+  if (!directory_.empty() && readFile_(key, entry)) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    insertMemory_(key, entry);
+    ++hits_;
+    return entry;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  ++misses_;
+  return std::nullopt;
+}
+
+void TrajectoryCache::store(const Key& key, const Entry& entry) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    insertMemory_(key, entry);
+  }
+
+  if (!directory_.empty()) {
+    writeFile_(key, entry);
+  }
+}
+
+void TrajectoryCache::insertMemory_(const Key& key, const Entry& entry) {
+  auto it = index_.find(key);
+  if (it != index_.end()) {
+    it->second->second = entry;
+    lru_.splice(lru_.begin(), lru_, it->second);
+    return;
+  }
+
+  lru_.emplace_front(key, entry);
+  index_[key] = lru_.begin();
+
+  if (lru_.size() > maxMemoryEntries_) {
+    index_.erase(lru_.back().first);
+    lru_.pop_back();
+  }
+}
+
+std::string TrajectoryCache::filePath_(const Key& key) const {
+  return (std::filesystem::path(directory_) / (key.toString() + ".traj")).string();
+}
+
+bool TrajectoryCache::readFile_(const Key& key, Entry& entry) const {
+  std::ifstream file(filePath_(key), std::ios::binary);
+  if (!file) {
+    return false;
+  }
+
+  // Entries written with another message definition are ignored
+  const std::string md5 = ros::message_traits::MD5Sum<trajectory_msgs::JointTrajectory>::value();
+  char magic[sizeof(FILE_MAGIC)];
+  std::string fileMd5(md5.size(), '\0');
+  double origin[3];
+  if (!file.read(magic, sizeof(magic)) || std::memcmp(magic, FILE_MAGIC, sizeof(magic)) != 0
+      || !file.read(&fileMd5[0], fileMd5.size()) || fileMd5 != md5
+      || !file.read(reinterpret_cast<char*>(origin), sizeof(origin))) {
+    return false;
+  }
+  entry.origin = Eigen::Vector3d(origin[0], origin[1], origin[2]);
+
+  std::vector<std::uint8_t> buffer((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  try {
+    ros::serialization::IStream stream(buffer.data(), static_cast<std::uint32_t>(buffer.size()));
+    ros::serialization::deserialize(stream, entry.trajectory);
+  } catch (const ros::serialization::StreamOverrunException& e) {
+    ROS_WARN_STREAM("[TrajectoryCache] - Corrupted entry " << key.toString() << ": " << e.what());
+    return false;
+  }
+
+  return true;
+}
+
+void TrajectoryCache::writeFile_(const Key& key, const Entry& entry) const {
+  const std::uint32_t size = ros::serialization::serializationLength(entry.trajectory);
+  std::vector<std::uint8_t> buffer(size);
+  ros::serialization::OStream stream(buffer.data(), size);
+  ros::serialization::serialize(stream, entry.trajectory);
+
+  // Write aside then rename, so a concurrent reader never sees a partial entry
+  const std::string path = filePath_(key);
+  const std::string tmpPath = path + ".tmp" + std::to_string(::getpid());
+  {
+    const std::string md5 = ros::message_traits::MD5Sum<trajectory_msgs::JointTrajectory>::value();
+    std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+    file.write(FILE_MAGIC, sizeof(FILE_MAGIC));
+    file.write(md5.data(), md5.size());
+    const double origin[3] = {entry.origin.x(), entry.origin.y(), entry.origin.z()};
+    file.write(reinterpret_cast<const char*>(origin), sizeof(origin));
+    file.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+    if (!file) {
+      ROS_WARN_STREAM("[TrajectoryCache] - Failed to write " << tmpPath << ".");
+      std::remove(tmpPath.c_str());
+      return;
+    }
+  }
+
+  std::error_code ec;
+  std::filesystem::rename(tmpPath, path, ec);
+  if (ec) {
+    ROS_WARN_STREAM("[TrajectoryCache] - Failed to store " << path << ": " << ec.message());
+    std::remove(tmpPath.c_str());
+  }
+}
+
+} // namespace wp5_planner
@@ -0,0 +1,61 @@
+/**
+ * @file TrajectoryParameterizer.cpp
+ * @brief Time parameterization of a layer planned in joint space.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include "wp5_planner/TrajectoryParameterizer.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace wp5_planner {
+
+trajectory_msgs::JointTrajectory parameterizeTrajectory(const std::vector<Eigen::Isometry3d>& waypoints,
+                                                        const std::vector<Eigen::VectorXd>& joints,
+                                                        const std::vector<std::string>& jointNames,
+                                                        const Eigen::VectorXd& velocityLimits,
+                                                        double depositionSpeed,
+                                                        double velocityScaling) {
+  if (waypoints.size() != joints.size()) {
+    throw std::invalid_argument("[parameterizeTrajectory] - Waypoints and joint solutions size mismatch.");
+  }
+  if (depositionSpeed <= 0.0 || velocityScaling <= 0.0) {
+    throw std::invalid_argument("[parameterizeTrajectory] - Speeds must be strictly positive.");
+  }
+
+  const std::size_t nbPoints = waypoints.size();
+  const Eigen::ArrayXd maxVelocity = velocityLimits.array() * std::min(velocityScaling, 1.0);
+
+  // Time stamps, limited by the deposition speed and the joint velocities
+  std::vector<double> times(nbPoints, 0.0);
+  for (std::size_t i = 1; i < nbPoints; ++i) {
+    const double length = (waypoints[i].translation() - waypoints[i - 1].translation()).norm();
+    const double jointDuration = ((joints[i] - joints[i - 1]).array().abs() / maxVelocity).maxCoeff();
+
+    times[i] = times[i - 1] + std::max(length / depositionSpeed, jointDuration);
+  }
+
+  trajectory_msgs::JointTrajectory trajectory;
+  trajectory.joint_names = jointNames;
+  trajectory.points.resize(nbPoints);
+
+  for (std::size_t i = 0; i < nbPoints; ++i) {
+    trajectory_msgs::JointTrajectoryPoint& point = trajectory.points[i];
+    point.positions.assign(joints[i].data(), joints[i].data() + joints[i].size());
+    point.time_from_start = ros::Duration(times[i]);
+
+    // Central differences inside the layer, at rest on both ends
+    Eigen::VectorXd velocity = Eigen::VectorXd::Zero(joints[i].size());
+    if (i > 0 && i + 1 < nbPoints && times[i + 1] > times[i - 1]) {
+      velocity = (joints[i + 1] - joints[i - 1]) / (times[i + 1] - times[i - 1]);
+    }
+    point.velocities.assign(velocity.data(), velocity.data() + velocity.size());
+  }
+
+  return trajectory;
+}
+
+} // namespace wp5_planner
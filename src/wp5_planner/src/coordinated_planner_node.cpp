@@ -0,0 +1,258 @@
+/**
+ * @file coordinated_planner_node.cpp
+ * @brief ROS node planning layers with coordinated robot and positioner motion.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include <ros/ros.h>
+#include <wp5_common/Metrics.h>
+#include <wp5_common/TraceRecorder.h>
+#include <wp5_common/Tracing.h>
+#include <wp5_msgs/PlanCoordinatedLayer.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "wp5_planner/CoordinatedIkSolver.h"
+#include "wp5_planner/TrajectoryCache.h"
+#include "wp5_planner/TrajectoryParameterizer.h"
+
+namespace wp5_planner {
+
+namespace {
+
+Eigen::Vector3d readVector(const ros::NodeHandle& nh, const std::string& name, const Eigen::Vector3d& fallback) {
+  std::vector<double> values;
+  if (!nh.getParam(name, values) || values.size() != 3) {
+    return fallback;
+  }
+  return Eigen::Vector3d(values[0], values[1], values[2]);
+}
+
+Eigen::Isometry3d toEigen(const geometry_msgs::Pose& pose) {
+  Eigen::Isometry3d transform = Eigen::Isometry3d::Identity();
+  transform.translation() = Eigen::Vector3d(pose.position.x, pose.position.y, pose.position.z);
+  transform.linear() =
+      Eigen::Quaterniond(pose.orientation.w, pose.orientation.x, pose.orientation.y, pose.orientation.z)
+          .normalized()
+          .toRotationMatrix();
+  return transform;
+}
+
+std::string defaultCacheDirectory() {
+  const char* rosHome = std::getenv("ROS_HOME");
+  const char* home = std::getenv("HOME");
+  const std::string root = rosHome ? rosHome : std::string(home ? home : ".") + "/.ros";
+  return root + "/wp5_trajectory_cache";
+}
+
+} // namespace
+
+class CoordinatedPlannerNode {
+public:
+  CoordinatedPlannerNode(ros::NodeHandle& nh, ros::NodeHandle& pnh) {
+    std::string urdf;
+    if (!nh.getParam("robot_description", urdf)) {
+      throw std::runtime_error("[CoordinatedPlannerNode] - Missing robot_description parameter.");
+    }
+
+    const std::string worldFrame = pnh.param<std::string>("world_frame", "world");
+    const std::string partFrame = pnh.param<std::string>("part_frame", "positioner_table");
+    const std::string toolFrame = pnh.param<std::string>("tool_frame", "tool0");
+
+    CoordinatedIkParameters params;
+    params.maxIterations = pnh.param("ik/max_iterations", params.maxIterations);
+    params.positionTolerance = pnh.param("ik/position_tolerance", params.positionTolerance);
+    params.orientationTolerance = pnh.param("ik/orientation_tolerance", params.orientationTolerance);
+    params.damping = pnh.param("ik/damping", params.damping);
+    params.maxStep = pnh.param("ik/max_step", params.maxStep);
+    params.gravityWeight = pnh.param("ik/gravity_weight", params.gravityWeight);
+    params.gravity = readVector(pnh, "ik/gravity", params.gravity);
+    params.toolAxis = readVector(pnh, "ik/tool_axis", params.toolAxis);
+    params.coarseStride = static_cast<std::size_t>(pnh.param("ik/coarse_stride", 16));
+    params.nbThreads = static_cast<std::size_t>(pnh.param("ik/nb_threads", 0));
+
+    velocityScaling_ = pnh.param("velocity_scaling", 1.0);
+
+    solver_ = std::make_unique<CoordinatedIkSolver>(urdf, worldFrame, partFrame, toolFrame, params);
+
+    if (pnh.param("cache/enabled", true)) {
+      cache_ = std::make_unique<TrajectoryCache>(pnh.param("cache/directory", defaultCacheDirectory()),
+                                                 static_cast<std::size_t>(pnh.param("cache/max_memory_entries", 64)),
+                                                 pnh.param("cache/resolution", 1e-6),
+                                                 pnh.param("cache/start_resolution", 0.05));
+
+      // Anything changing the planned trajectory for a given layer must invalidate the entries
+      std::ostringstream context;
+      context << urdf << worldFrame << partFrame << toolFrame << params.maxIterations << params.positionTolerance
+              << params.orientationTolerance << params.damping << params.maxStep << params.gravityWeight
+              << params.gravity.transpose() << params.toolAxis.transpose() << params.coarseStride << velocityScaling_;
+      cacheContext_ = TrajectoryCache::hashContext(context.str());
+    }
+    planDuration_ = &metrics_.histogram("plan duration");
+    cacheHits_ = &metrics_.counter("cache hits");
+    cacheWarmStarts_ = &metrics_.counter("cache warm starts");
+    failedPlans_ = &metrics_.counter("failed plans");
+    metrics_.advertise(nh, pnh, ros::this_node::getName(), "Coordinated planner");
+
+    service_ = nh.advertiseService("plan_coordinated_layer", &CoordinatedPlannerNode::planLayer_, this);
+    wp5_common::TraceRecorder::attach(nh);
+
+    ROS_INFO_STREAM("[CoordinatedPlannerNode] - Planning group of " << solver_->getNbJoints() << " joints, from "
+                                                                    << partFrame << " to " << toolFrame << ".");
+  }
+
+private:
+  bool planLayer_(wp5_msgs::PlanCoordinatedLayer::Request& req, wp5_msgs::PlanCoordinatedLayer::Response& res) {
+    WP5_TRACE_SCOPE("planner", "plan_layer");
+    const std::vector<std::string>& jointNames = solver_->getJointNames();
+
+    if (req.waypoints.poses.empty()) {
+      res.success = false;
+      res.message = "Empty layer.";
+      return true;
+    }
+
+    // Seed from the current state, joints missing from the request start at zero
+    Eigen::VectorXd seed = Eigen::VectorXd::Zero(jointNames.size());
+    for (std::size_t i = 0; i < req.start_state.name.size() && i < req.start_state.position.size(); ++i) {
+      auto it = std::find(jointNames.begin(), jointNames.end(), req.start_state.name[i]);
+      if (it != jointNames.end()) {
+        seed[std::distance(jointNames.begin(), it)] = req.start_state.position[i];
+      }
+    }
+
+    std::vector<Eigen::Isometry3d> waypoints;
+    waypoints.reserve(req.waypoints.poses.size());
+    for (const geometry_msgs::Pose& pose : req.waypoints.poses) {
+      waypoints.push_back(toEigen(pose));
+    }
+
+    TrajectoryCache::Key key;
+    std::vector<Eigen::VectorXd> warmSeeds;
+    if (cache_) {
+      key = cache_->computeKey(waypoints, seed, req.deposition_speed, cacheContext_);
+      std::optional<TrajectoryCache::Entry> cached = cache_->find(key);
+
+      // Same layer shape elsewhere, its joints seed the IK of every waypoint
+      if (cached && !cache_->isSameOrigin(*cached, waypoints.front().translation())) {
+        warmSeeds = warmSeeds_(cached->trajectory, waypoints.size());
+        cached.reset();
+      }
+
+      if (cached) {
+        res.trajectory = std::move(cached->trajectory);
+        res.trajectory.header.stamp = ros::Time::now();
+        res.trajectory.header.frame_id = req.waypoints.header.frame_id;
+        res.success = true;
+        res.message = "Reused cached trajectory " + key.toString() + ".";
+        cacheHits_->add();
+        return true;
+      }
+    }
+
+    const ros::WallTime start = ros::WallTime::now();
+    std::vector<IkResult> results;
+    {
+      WP5_TRACE_SCOPE("planner", "ik");
+      bool warmStarted = false;
+      if (!warmSeeds.empty()) {
+        results = solver_->solveBatch(waypoints, warmSeeds);
+        warmStarted =
+            std::all_of(results.begin(), results.end(), [](const IkResult& result) { return result.success; });
+        if (warmStarted) {
+          cacheWarmStarts_->add();
+        } else {
+          ROS_WARN_STREAM("[CoordinatedPlannerNode] - Warm start from " << key.toString() << " failed, solving again.");
+        }
+      }
+      if (!warmStarted) {
+        results = solver_->solveBatch(waypoints, seed);
+      }
+    }
+
+    std::vector<Eigen::VectorXd> joints;
+    joints.reserve(results.size());
+    for (std::size_t i = 0; i < results.size(); ++i) {
+      if (!results[i].success) {
+        res.success = false;
+        res.message = "IK failed at waypoint " + std::to_string(i) + ".";
+        failedPlans_->add();
+        return true;
+      }
+      joints.push_back(results[i].joints);
+    }
+
+    try {
+      WP5_TRACE_SCOPE("planner", "parameterize");
+      res.trajectory = parameterizeTrajectory(
+          waypoints, joints, jointNames, solver_->getVelocityLimits(), req.deposition_speed, velocityScaling_);
+    } catch (const std::invalid_argument& e) {
+      res.success = false;
+      res.message = e.what();
+      failedPlans_->add();
+      return true;
+    }
+    planDuration_->record(static_cast<std::uint64_t>((ros::WallTime::now() - start).toNSec()));
+
+    if (cache_) {
+      cache_->store(key, TrajectoryCache::Entry{res.trajectory, waypoints.front().translation()});
+    }
+
+    res.trajectory.header.stamp = ros::Time::now();
+    res.trajectory.header.frame_id = req.waypoints.header.frame_id;
+    res.success = true;
+    return true;
+  }
+
+  // Joints of each point of a cached trajectory, empty when it does not match the layer
+  std::vector<Eigen::VectorXd> warmSeeds_(const trajectory_msgs::JointTrajectory& trajectory,
+                                          std::size_t nbWaypoints) const {
+    if (trajectory.points.size() != nbWaypoints || trajectory.joint_names != solver_->getJointNames()) {
+      return {};
+    }
+
+    std::vector<Eigen::VectorXd> seeds;
+    seeds.reserve(nbWaypoints);
+    for (const trajectory_msgs::JointTrajectoryPoint& point : trajectory.points) {
+      if (point.positions.size() != solver_->getNbJoints()) {
+        return {};
+      }
+      seeds.push_back(Eigen::Map<const Eigen::VectorXd>(point.positions.data(), point.positions.size()));
+    }
+    return seeds;
+  }
+
+  std::unique_ptr<CoordinatedIkSolver> solver_;
+  std::unique_ptr<TrajectoryCache> cache_;
+  std::uint64_t cacheContext_ = 0;
+  ros::ServiceServer service_;
+  double velocityScaling_ = 1.0;
+
+  wp5_common::MetricsRegistry metrics_;
+  wp5_common::Histogram* planDuration_ = nullptr;
+  wp5_common::Counter* cacheHits_ = nullptr;
+  wp5_common::Counter* cacheWarmStarts_ = nullptr;
+  wp5_common::Counter* failedPlans_ = nullptr;
+};
+
+} // namespace wp5_planner
+
+int main(int argc, char** argv) {
+  ros::init(argc, argv, "coordinated_planner");
+  ros::NodeHandle nh;
+  ros::NodeHandle pnh("~");
+
+  wp5_planner::CoordinatedPlannerNode node(nh, pnh);
+  ros::spin();
+
+  return 0;
+}
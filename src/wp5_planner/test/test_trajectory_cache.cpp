@@ -0,0 +1,119 @@
+/**
+ * @file test_trajectory_cache.cpp
+ * @brief Unit tests of the layer trajectory cache keys and stores.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "wp5_planner/TrajectoryCache.h"
+
+namespace wp5_planner {
+
+namespace {
+
+std::vector<Eigen::Isometry3d> squareLayer(double z) {
+  const Eigen::Vector3d corners[4] = {{0.0, 0.0, z}, {0.1, 0.0, z}, {0.1, 0.1, z}, {0.0, 0.1, z}};
+  std::vector<Eigen::Isometry3d> waypoints(4, Eigen::Isometry3d::Identity());
+  for (int i = 0; i < 4; ++i) {
+    waypoints[i].translation() = corners[i];
+  }
+  return waypoints;
+}
+
+Eigen::VectorXd startState() {
+  Eigen::VectorXd state(3);
+  state << 0.1, -1.2, 1.6;
+  return state;
+}
+
+TrajectoryCache::Entry makeEntry(const Eigen::Vector3d& origin) {
+  TrajectoryCache::Entry entry;
+  entry.trajectory.joint_names = {"a", "b", "c"};
+  entry.trajectory.points.resize(4);
+  for (std::size_t i = 0; i < entry.trajectory.points.size(); ++i) {
+    entry.trajectory.points[i].positions = {0.1 * i, 0.2, 0.3};
+  }
+  entry.origin = origin;
+  return entry;
+}
+
+} // namespace
+
+TEST(TrajectoryCache, RejectsNonPositiveResolution) {
+  EXPECT_THROW(TrajectoryCache("", 4, 0.0), std::invalid_argument);
+  EXPECT_THROW(TrajectoryCache("", 4, -1e-6), std::invalid_argument);
+  EXPECT_THROW(TrajectoryCache("", 4, 1e-6, 0.0), std::invalid_argument);
+}
+
+TEST(TrajectoryCache, ShiftedLayersShareKey) {
+  const TrajectoryCache cache("", 4);
+  const TrajectoryCache::Key key = cache.computeKey(squareLayer(0.0), startState(), 0.01, 1);
+  EXPECT_EQ(key, cache.computeKey(squareLayer(0.0018), startState(), 0.01, 1));
+}
+
+TEST(TrajectoryCache, StartStateNoiseKeepsKey) {
+  const TrajectoryCache cache("", 4, 1e-6, 0.05);
+  Eigen::VectorXd noisy = startState();
+  noisy += Eigen::VectorXd::Constant(noisy.size(), 1e-3);
+  EXPECT_EQ(cache.computeKey(squareLayer(0.0), startState(), 0.01, 1),
+            cache.computeKey(squareLayer(0.0), noisy, 0.01, 1));
+}
+
+TEST(TrajectoryCache, DistinctRequestsDiffer) {
+  const TrajectoryCache cache("", 4);
+  const TrajectoryCache::Key key = cache.computeKey(squareLayer(0.0), startState(), 0.01, 1);
+
+  std::vector<Eigen::Isometry3d> stretched = squareLayer(0.0);
+  stretched[2].translation().x() += 1e-3;
+  EXPECT_FALSE(key == cache.computeKey(stretched, startState(), 0.01, 1));
+  EXPECT_FALSE(key == cache.computeKey(squareLayer(0.0), startState(), 0.02, 1));
+  EXPECT_FALSE(key == cache.computeKey(squareLayer(0.0), startState(), 0.01, 2));
+
+  Eigen::VectorXd otherBranch = startState();
+  otherBranch[1] += 1.0;
+  EXPECT_FALSE(key == cache.computeKey(squareLayer(0.0), otherBranch, 0.01, 1));
+}
+
+TEST(TrajectoryCache, EvictsLeastRecentlyUsed) {
+  TrajectoryCache cache("", 2);
+  const TrajectoryCache::Key keys[3] = {{0, 1}, {0, 2}, {0, 3}};
+  for (const TrajectoryCache::Key& key : keys) {
+    cache.store(key, makeEntry(Eigen::Vector3d::Zero()));
+  }
+
+  EXPECT_FALSE(cache.find(keys[0]).has_value());
+  EXPECT_TRUE(cache.find(keys[1]).has_value());
+  EXPECT_TRUE(cache.find(keys[2]).has_value());
+  EXPECT_EQ(cache.getHits(), 2u);
+  EXPECT_EQ(cache.getMisses(), 1u);
+}
+
+TEST(TrajectoryCache, PersistsEntriesWithTheirOrigin) {
+  const std::filesystem::path directory =
+      std::filesystem::temp_directory_path() / ("wp5_trajectory_cache_test_" + std::to_string(::getpid()));
+  const TrajectoryCache::Key key{42, 7};
+  const Eigen::Vector3d origin(0.0, 0.0, 0.0018);
+
+  TrajectoryCache(directory.string(), 1).store(key, makeEntry(origin));
+
+  TrajectoryCache reloaded(directory.string(), 1);
+  const std::optional<TrajectoryCache::Entry> entry = reloaded.find(key);
+  std::filesystem::remove_all(directory);
+
+  ASSERT_TRUE(entry.has_value());
+  ASSERT_EQ(entry->trajectory.points.size(), 4u);
+  EXPECT_DOUBLE_EQ(entry->trajectory.points[3].positions[0], 0.3);
+  EXPECT_TRUE(reloaded.isSameOrigin(*entry, origin));
+  EXPECT_FALSE(reloaded.isSameOrigin(*entry, Eigen::Vector3d::Zero()));
+}
+
+} // namespace wp5_planner
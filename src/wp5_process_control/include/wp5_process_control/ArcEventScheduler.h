@@ -0,0 +1,121 @@
+/**
+ * @file ArcEventScheduler.h
+ * @brief Arc switches triggered at precomputed times of the controller path.
+ *
+ * A schedule is armed ahead of the path, its Modbus writes already built. It binds to the next path started by the
+ * controller, whose trajectory clock gives the mapping from path time to wall time. A dedicated thread sleeps until
+ * shortly before each write, busy waits the remaining time and publishes the pre-built write, so the switch does not
+ * depend on the control period nor on the callback queue. With simulated time, the thread polls the simulated clock
+ * in short wall clock waits instead, as it may run at any rate. The timing of each write, and of the arc switch
+ * reported by the welder when available, is published against the controller clock.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <ros/ros.h>
+#include <std_msgs/Bool.h>
+#include <wp5_common/Metrics.h>
+#include <wp5_msgs/ArcEventTiming.h>
+#include <wp5_msgs/ArcSchedule.h>
+#include <wp5_msgs/ModbusWrite.h>
+#include <wp5_msgs/TrajectoryClock.h>
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace wp5_process_control {
+
+class ArcEventScheduler {
+public:
+  ArcEventScheduler(ros::NodeHandle& nh, ros::NodeHandle& pnh);
+  ~ArcEventScheduler();
+
+  ArcEventScheduler(const ArcEventScheduler&) = delete;
+  ArcEventScheduler& operator=(const ArcEventScheduler&) = delete;
+
+private:
+  struct PendingEvent {
+    std::uint8_t type = wp5_msgs::ArcEvent::ARC_ON;
+    double plannedTime = 0.0;  // Arc switch [s]
+    double writeTime = 0.0;    // Planned time minus the welder latency [s]
+    wp5_msgs::ModbusWritePtr write;
+  };
+  using Schedule = std::vector<PendingEvent>;
+
+  struct AwaitingFeedback {
+    ros::Time origin;
+    ros::Time sent;
+    wp5_msgs::ArcEventTiming timing;
+  };
+
+  struct EventWrite {
+    wp5_msgs::ModbusWrite write;
+    double latency = 0.0;
+  };
+
+  void scheduleCallback_(const wp5_msgs::ArcScheduleConstPtr& msg);
+  void clockCallback_(const wp5_msgs::TrajectoryClockConstPtr& msg);
+  void arcStateCallback_(const std_msgs::BoolConstPtr& msg);
+  void flushTimings_(const ros::TimerEvent& event);
+
+  void dispatchLoop_();
+  void sleepUntil_(const ros::Time& target) const;
+  void reportTiming_(const PendingEvent& event, const ros::Time& origin, const ros::Time& sent);
+
+  // Called with the mutex locked
+  void updateQueueDepths_();
+
+  PendingEvent makeEvent_(std::uint8_t type, double plannedTime) const;
+  static EventWrite readEventWrite_(const ros::NodeHandle& pnh, const std::string& name);
+
+  std::array<EventWrite, 2> writes_;
+  double spinMargin_ = 5e-4;
+  double coarseWakeUp_ = 5e-3;
+  double simTimeSlice_ = 1e-3; // Wall time between two checks of the simulated clock [s]
+  bool useFeedback_ = false;
+  double feedbackTimeout_ = 0.5;
+
+  std::mutex mutex_;
+  std::condition_variable wakeUp_;
+  std::atomic<bool> running_{true}; // Also read unlocked by the spin
+
+  std::shared_ptr<const Schedule> armed_;
+  std::shared_ptr<const Schedule> active_;
+  std::size_t nextEvent_ = 0;
+  std::uint64_t lastGeneration_ = 0;
+  std::uint64_t activeGeneration_ = 0;
+  bool hasOrigin_ = false;
+  ros::Time origin_;  // Wall time of the start of the active path
+  bool arcOn_ = false;
+
+  std::deque<AwaitingFeedback> awaitingFeedback_;
+  bool arcState_ = false;
+
+  std::thread dispatcher_;
+
+  wp5_common::MetricsRegistry metrics_;
+  wp5_common::LoopMetric* clockLoop_ = nullptr;
+  wp5_common::Counter* droppedClocks_ = nullptr;
+  wp5_common::Histogram* writeLateness_ = nullptr;
+  wp5_common::Gauge* pendingEvents_ = nullptr;
+  wp5_common::Gauge* awaitingFeedbackSize_ = nullptr;
+
+  ros::Subscriber scheduleSub_;
+  ros::Subscriber clockSub_;
+  ros::Subscriber arcStateSub_;
+  ros::Publisher writePub_;
+  ros::Publisher timingPub_;
+  ros::Timer flushTimer_;
+};
+
+} // namespace wp5_process_control
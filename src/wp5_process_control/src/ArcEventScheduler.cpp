@@ -0,0 +1,292 @@
+/**
+ * @file ArcEventScheduler.cpp
+ * @brief Arc switches triggered at precomputed times of the controller path.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include "wp5_process_control/ArcEventScheduler.h"
+
+#include <time.h>
+#include <wp5_common/ThreadPlacement.h>
+#include <wp5_common/TraceRecorder.h>
+#include <wp5_common/Tracing.h>
+
+#include <algorithm>
+#include <boost/make_shared.hpp>
+#include <cerrno>
+#include <chrono>
+#include <limits>
+#include <stdexcept>
+
+namespace wp5_process_control {
+
+ArcEventScheduler::ArcEventScheduler(ros::NodeHandle& nh, ros::NodeHandle& pnh) {
+  writes_[wp5_msgs::ArcEvent::ARC_ON] = readEventWrite_(pnh, "arc_on");
+  writes_[wp5_msgs::ArcEvent::ARC_OFF] = readEventWrite_(pnh, "arc_off");
+
+  spinMargin_ = pnh.param("spin_margin", spinMargin_);
+  coarseWakeUp_ = std::max(spinMargin_, pnh.param("coarse_wake_up", coarseWakeUp_));
+  simTimeSlice_ = pnh.param("sim_time_slice", simTimeSlice_);
+  if (simTimeSlice_ <= 0.0) {
+    throw std::invalid_argument("[ArcEventScheduler] - sim_time_slice must be positive.");
+  }
+  useFeedback_ = pnh.param("feedback/enabled", useFeedback_);
+  feedbackTimeout_ = pnh.param("feedback/timeout", feedbackTimeout_);
+
+  clockLoop_ = &metrics_.loop("trajectory clock", pnh.param("diagnostics/clock_rate", 0.0));
+  droppedClocks_ = &metrics_.drops("trajectory clocks");
+  writeLateness_ = &metrics_.histogram("write lateness");
+  pendingEvents_ = &metrics_.gauge("pending events");
+  awaitingFeedbackSize_ = &metrics_.gauge("events awaiting feedback");
+  metrics_.advertise(nh, pnh, ros::this_node::getName(), "Arc scheduler");
+
+  writePub_ = nh.advertise<wp5_msgs::ModbusWrite>(pnh.param<std::string>("write_topic", "modbus_write"), 8);
+  timingPub_ = nh.advertise<wp5_msgs::ArcEventTiming>("arc_event_timing", 16);
+
+  scheduleSub_ = nh.subscribe("arc_schedule", 4, &ArcEventScheduler::scheduleCallback_, this);
+  clockSub_ = nh.subscribe(pnh.param<std::string>("clock_topic", "cartesian_path_controller/trajectory_clock"),
+                           1,
+                           &ArcEventScheduler::clockCallback_,
+                           this,
+                           ros::TransportHints().tcpNoDelay());
+
+  if (useFeedback_) {
+    arcStateSub_ = nh.subscribe(
+        "arc_state", 8, &ArcEventScheduler::arcStateCallback_, this, ros::TransportHints().tcpNoDelay());
+    flushTimer_ = nh.createTimer(ros::Duration(0.1), &ArcEventScheduler::flushTimings_, this);
+  }
+
+  wp5_common::TraceRecorder::attach(nh);
+  dispatcher_ = std::thread(&ArcEventScheduler::dispatchLoop_, this);
+
+  wp5_common::applyPlacement(
+      dispatcher_.native_handle(), wp5_common::readPlacement(pnh, "dispatcher"), "Arc event dispatcher");
+}
+
+ArcEventScheduler::~ArcEventScheduler() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    running_ = false;
+  }
+  wakeUp_.notify_all();
+  dispatcher_.join();
+}
+
+ArcEventScheduler::EventWrite ArcEventScheduler::readEventWrite_(const ros::NodeHandle& pnh, const std::string& name) {
+  std::vector<int> values;
+  if (!pnh.getParam(name + "/values", values) || values.empty()) {
+    throw std::runtime_error("[ArcEventScheduler] - Missing " + name + "/values parameter.");
+  }
+
+  EventWrite eventWrite;
+  eventWrite.write.device = pnh.param<std::string>(name + "/device", "welder");
+  eventWrite.write.address = static_cast<std::uint16_t>(pnh.param(name + "/address", 0));
+  eventWrite.write.values.assign(values.begin(), values.end());
+  eventWrite.latency = pnh.param(name + "/latency", 0.0);
+  return eventWrite;
+}
+
+ArcEventScheduler::PendingEvent ArcEventScheduler::makeEvent_(std::uint8_t type, double plannedTime) const {
+  PendingEvent event;
+  event.type = type;
+  event.plannedTime = plannedTime;
+  event.writeTime = plannedTime - writes_[type].latency;
+  event.write = boost::make_shared<wp5_msgs::ModbusWrite>(writes_[type].write);
+  return event;
+}
+
+void ArcEventScheduler::scheduleCallback_(const wp5_msgs::ArcScheduleConstPtr& msg) {
+  // Writes are built here, the dispatcher only stamps and publishes them
+  auto schedule = std::make_shared<Schedule>();
+  schedule->reserve(msg->events.size());
+  for (const wp5_msgs::ArcEvent& event : msg->events) {
+    if (event.type > wp5_msgs::ArcEvent::ARC_OFF) {
+      ROS_WARN_STREAM("[ArcEventScheduler] - Unknown arc event type " << static_cast<int>(event.type) << " skipped.");
+      continue;
+    }
+    schedule->push_back(makeEvent_(event.type, event.path_time));
+  }
+  std::stable_sort(schedule->begin(), schedule->end(), [](const PendingEvent& a, const PendingEvent& b) {
+    return a.writeTime < b.writeTime;
+  });
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  armed_ = schedule;
+  ROS_INFO_STREAM("[ArcEventScheduler] - " << schedule->size() << " arc events armed for the next path.");
+}
+
+void ArcEventScheduler::clockCallback_(const wp5_msgs::TrajectoryClockConstPtr& msg) {
+  clockLoop_->tick();
+  droppedClocks_->addSequenceGap(msg->header.seq);
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  if (msg->generation != lastGeneration_) {
+    lastGeneration_ = msg->generation;
+
+    auto schedule = std::make_shared<Schedule>();
+
+    // The path the arc was started for is gone, stop it right away
+    if (arcOn_) {
+      ROS_WARN("[ArcEventScheduler] - Path replaced with the arc on, switching it off.");
+      schedule->push_back(
+          makeEvent_(wp5_msgs::ArcEvent::ARC_OFF, msg->path_time + writes_[wp5_msgs::ArcEvent::ARC_OFF].latency));
+    }
+
+    if (armed_) {
+      schedule->insert(schedule->end(), armed_->begin(), armed_->end());
+      armed_.reset();
+      ROS_INFO_STREAM("[ArcEventScheduler] - Arc events bound to path " << msg->generation << ".");
+    }
+
+    active_ = schedule->empty() ? nullptr : schedule;
+    activeGeneration_ = msg->generation;
+    nextEvent_ = 0;
+    hasOrigin_ = false;
+    updateQueueDepths_();
+  }
+
+  // Refined on every cycle, the dispatcher extrapolates between two of them
+  const bool hadOrigin = hasOrigin_;
+  origin_ = msg->header.stamp - ros::Duration(msg->path_time);
+  hasOrigin_ = true;
+
+  if (!hadOrigin) {
+    wakeUp_.notify_one();
+  }
+}
+
+void ArcEventScheduler::dispatchLoop_() {
+  WP5_TRACE_THREAD("arc_dispatcher");
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  while (running_) {
+    if (!active_ || !hasOrigin_ || nextEvent_ >= active_->size()) {
+      wakeUp_.wait(lock);
+      continue;
+    }
+
+    // The schedule is kept alive by this copy even if replaced while unlocked
+    const std::shared_ptr<const Schedule> schedule = active_;
+    const std::size_t index = nextEvent_;
+    const PendingEvent& event = (*schedule)[index];
+    const ros::Time target = origin_ + ros::Duration(event.writeTime);
+
+    const double remaining = (target - ros::Time::now()).toSec();
+    if (ros::Time::isSimTime()) {
+      // The simulated clock runs at any rate against the wall clock, it is checked again after each short wait
+      if (remaining > 0.0) {
+        wakeUp_.wait_for(lock, std::chrono::duration<double>(simTimeSlice_));
+        continue;
+      }
+    } else {
+      // Coarse wait, interrupted by a new path and picking up the latest clock origin when woken up
+      if (remaining > coarseWakeUp_) {
+        wakeUp_.wait_for(lock, std::chrono::duration<double>(remaining - coarseWakeUp_));
+        continue;
+      }
+
+      // The spin is bounded, a clock stepping back or a stop request sends it back to the wait above
+      lock.unlock();
+      sleepUntil_(target - ros::Duration(spinMargin_));
+      const auto spinDeadline = std::chrono::steady_clock::now() + std::chrono::duration<double>(2.0 * spinMargin_);
+      while (running_ && ros::Time::now() < target && std::chrono::steady_clock::now() < spinDeadline) {
+      }
+      lock.lock();
+
+      if (ros::Time::now() < target) {
+        continue;
+      }
+    }
+
+    if (!running_ || active_ != schedule || nextEvent_ != index) {
+      continue;
+    }
+
+    {
+      WP5_TRACE_SCOPE("modbus", "arc_write");
+      event.write->header.stamp = ros::Time::now();
+      writePub_.publish(event.write);
+    }
+    const std::int64_t lateness = (event.write->header.stamp - target).toNSec();
+    writeLateness_->record(static_cast<std::uint64_t>(std::max<std::int64_t>(0, lateness)));
+
+    ++nextEvent_;
+    arcOn_ = event.type == wp5_msgs::ArcEvent::ARC_ON;
+    reportTiming_(event, origin_, event.write->header.stamp);
+    updateQueueDepths_();
+  }
+}
+
+void ArcEventScheduler::sleepUntil_(const ros::Time& target) const {
+  // Outside of simulation, ros::Time follows CLOCK_REALTIME
+  timespec wakeUp{};
+  wakeUp.tv_sec = target.sec;
+  wakeUp.tv_nsec = target.nsec;
+  while (clock_nanosleep(CLOCK_REALTIME, TIMER_ABSTIME, &wakeUp, nullptr) == EINTR) {
+  }
+}
+
+void ArcEventScheduler::reportTiming_(const PendingEvent& event, const ros::Time& origin, const ros::Time& sent) {
+  wp5_msgs::ArcEventTiming timing;
+  timing.header.stamp = sent;
+  timing.type = event.type;
+  timing.generation = activeGeneration_;
+  timing.planned_time = event.plannedTime;
+  timing.write_time = (sent - origin).toSec();
+  timing.write_error = timing.write_time - event.writeTime;
+  timing.arc_time = std::numeric_limits<double>::quiet_NaN();
+  timing.arc_error = std::numeric_limits<double>::quiet_NaN();
+
+  if (!useFeedback_) {
+    timingPub_.publish(timing);
+    return;
+  }
+
+  awaitingFeedback_.push_back({origin, sent, timing});
+}
+
+void ArcEventScheduler::updateQueueDepths_() {
+  pendingEvents_->set(active_ ? static_cast<std::int64_t>(active_->size() - nextEvent_) : 0);
+  awaitingFeedbackSize_->set(static_cast<std::int64_t>(awaitingFeedback_.size()));
+}
+
+void ArcEventScheduler::arcStateCallback_(const std_msgs::BoolConstPtr& msg) {
+  const ros::Time now = ros::Time::now();
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  if (msg->data == arcState_) {
+    return;
+  }
+  arcState_ = msg->data;
+
+  const std::uint8_t type = arcState_ ? wp5_msgs::ArcEvent::ARC_ON : wp5_msgs::ArcEvent::ARC_OFF;
+  auto it = std::find_if(awaitingFeedback_.begin(), awaitingFeedback_.end(), [type](const AwaitingFeedback& pending) {
+    return pending.timing.type == type;
+  });
+  if (it == awaitingFeedback_.end()) {
+    ROS_WARN_STREAM("[ArcEventScheduler] - Arc switched " << (arcState_ ? "on" : "off") << " without pending event.");
+    return;
+  }
+
+  it->timing.arc_time = (now - it->origin).toSec();
+  it->timing.arc_error = it->timing.arc_time - it->timing.planned_time;
+  timingPub_.publish(it->timing);
+  awaitingFeedback_.erase(it);
+  updateQueueDepths_();
+}
+
+void ArcEventScheduler::flushTimings_(const ros::TimerEvent& /*event*/) {
+  const ros::Time now = ros::Time::now();
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  // Events the welder never acknowledged are reported without arc timing
+  while (!awaitingFeedback_.empty() && (now - awaitingFeedback_.front().sent).toSec() > feedbackTimeout_) {
+    timingPub_.publish(awaitingFeedback_.front().timing);
+    awaitingFeedback_.pop_front();
+  }
+  updateQueueDepths_();
+}
+
+} // namespace wp5_process_control
@@ -0,0 +1,22 @@
+/**
+ * @file arc_scheduler_node.cpp
+ * @brief ROS node triggering the arc switches at precomputed times of the controller path.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include <ros/ros.h>
+
+#include "wp5_process_control/ArcEventScheduler.h"
+
+int main(int argc, char** argv) {
+  ros::init(argc, argv, "arc_scheduler");
+  ros::NodeHandle nh;
+  ros::NodeHandle pnh("~");
+
+  wp5_process_control::ArcEventScheduler scheduler(nh, pnh);
+  ros::spin();
+
+  return 0;
+}
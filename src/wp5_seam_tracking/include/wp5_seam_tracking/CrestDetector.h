@@ -0,0 +1,64 @@
+/**
+ * @file CrestDetector.h
+ * @brief Detection of the previous bead crest in a laser line profile.
+ *
+ * The profile is smoothed with a box filter, the highest point is searched in a window around the last detection and
+ * refined to sub-sample accuracy with a parabola through its neighbours. When no crest stands out in the window, or the
+ * previous profile missed it, the whole profile is searched again. Buffers are kept between calls, so no allocation
+ * happens once the profile size is stable.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace wp5_seam_tracking {
+
+struct CrestDetectorParameters {
+  std::size_t smoothingHalfWidth = 3; // Samples on each side of the box filter
+  double searchWindow = 0.01;         // Lateral window around the last crest [m], <= 0 searches the whole profile
+  double minProminence = 0.3e-3;      // Minimum crest height above the profile edges [m]
+  double maxProminence = 3e-3;        // Prominence giving full quality [m]
+};
+
+struct Crest {
+  bool valid = false;
+  double lateral = 0.0; // [m]
+  double height = 0.0;  // [m]
+  double quality = 0.0; // In [0, 1]
+};
+
+class CrestDetector {
+public:
+  explicit CrestDetector(const CrestDetectorParameters& params = CrestDetectorParameters()) : params_(params) {}
+
+  /**
+   * @brief Detect the crest of a profile sorted by increasing lateral position.
+   *
+   * @param lateral Lateral position of each sample [m].
+   * @param height Height of each sample [m], NaN for missing samples.
+   */
+  Crest detect(const std::vector<double>& lateral, const std::vector<double>& height);
+
+  void reset() { hasPrevious_ = false; }
+
+private:
+  // Crest of the smoothed profile between the samples first and last included, both strictly inside the profile
+  Crest search_(std::size_t first, std::size_t last) const;
+
+  CrestDetectorParameters params_;
+
+  bool hasPrevious_ = false;
+  double previousLateral_ = 0.0;
+
+  std::vector<double> validLateral_;
+  std::vector<double> validHeight_;
+  std::vector<double> prefix_;
+  std::vector<double> smoothed_;
+};
+
+} // namespace wp5_seam_tracking
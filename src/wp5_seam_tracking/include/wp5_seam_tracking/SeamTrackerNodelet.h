@@ -0,0 +1,62 @@
+/**
+ * @file SeamTrackerNodelet.h
+ * @brief Bead tracking from laser line profiles, streaming path corrections to the controller.
+ *
+ * Each profile is reduced to the crest of the previous bead, compared to its nominal position under the torch, and the
+ * filtered offset is published right away on path_correction, where the controller picks it up through a
+ * PathCorrectionBuffer.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <nodelet/nodelet.h>
+#include <ros/ros.h>
+#include <sensor_msgs/PointCloud2.h>
+#include <wp5_common/Metrics.h>
+#include <wp5_msgs/PathCorrection.h>
+
+#include <string>
+#include <vector>
+
+#include "wp5_seam_tracking/CrestDetector.h"
+
+namespace wp5_seam_tracking {
+
+class SeamTrackerNodelet : public nodelet::Nodelet {
+public:
+  void onInit() override;
+
+private:
+  void profileCallback_(const sensor_msgs::PointCloud2ConstPtr& msg);
+
+  CrestDetector detector_;
+
+  std::string lateralAxis_;
+  std::string heightAxis_;
+  double lateralSign_ = 1.0;
+  double heightSign_ = 1.0;
+  double nominalLateral_ = 0.0;
+  double nominalHeight_ = 0.0;
+  double filterGain_ = 1.0;
+
+  bool hasCorrection_ = false;
+  wp5_msgs::PathCorrection correction_;
+
+  // Reused between profiles
+  std::vector<double> lateral_;
+  std::vector<double> height_;
+
+  wp5_common::MetricsRegistry metrics_;
+  wp5_common::LoopMetric* profileLoop_ = nullptr;
+  wp5_common::Counter* droppedProfiles_ = nullptr;
+  wp5_common::Counter* invalidProfiles_ = nullptr;
+  wp5_common::Counter* missedCrests_ = nullptr;
+
+  ros::Subscriber profileSub_;
+  ros::Publisher correctionPub_;
+};
+
+} // namespace wp5_seam_tracking
@@ -0,0 +1,120 @@
+/**
+ * @file CrestDetector.cpp
+ * @brief Detection of the previous bead crest in a laser line profile.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include "wp5_seam_tracking/CrestDetector.h"
+
+#include <wp5_common/Simd.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace wp5_seam_tracking {
+
+namespace {
+
+// Box filter through a prefix sum, constant cost per sample whatever the width. The edges, where the box is clipped,
+// are apart so that the interior loop has contiguous loads only and vectorizes.
+WP5_TARGET_CLONES
+void boxFilter(const double* values, std::size_t nbSamples, std::size_t halfWidth, double* prefix, double* smoothed) {
+  prefix[0] = 0.0;
+  for (std::size_t i = 0; i < nbSamples; ++i) {
+    prefix[i + 1] = prefix[i] + values[i];
+  }
+
+  const std::size_t width = 2 * halfWidth + 1;
+  for (std::size_t i = halfWidth; i + halfWidth < nbSamples; ++i) {
+    smoothed[i] = (prefix[i + halfWidth + 1] - prefix[i - halfWidth]) / static_cast<double>(width);
+  }
+  for (std::size_t i = 0; i < halfWidth; ++i) {
+    smoothed[i] = prefix[i + halfWidth + 1] / static_cast<double>(i + halfWidth + 1);
+    const std::size_t last = nbSamples - 1 - i;
+    smoothed[last] = (prefix[nbSamples] - prefix[last - halfWidth]) / static_cast<double>(i + halfWidth + 1);
+  }
+}
+
+} // namespace
+
+Crest CrestDetector::detect(const std::vector<double>& lateral, const std::vector<double>& height) {
+  Crest crest;
+  const std::size_t size = std::min(lateral.size(), height.size());
+
+  validLateral_.clear();
+  validHeight_.clear();
+  for (std::size_t i = 0; i < size; ++i) {
+    if (std::isfinite(height[i])) {
+      validLateral_.push_back(lateral[i]);
+      validHeight_.push_back(height[i]);
+    }
+  }
+
+  const std::size_t nbSamples = validHeight_.size();
+  const std::size_t halfWidth = params_.smoothingHalfWidth;
+  if (nbSamples < 2 * halfWidth + 3) {
+    hasPrevious_ = false;
+    return crest;
+  }
+
+  prefix_.resize(nbSamples + 1);
+  smoothed_.resize(nbSamples);
+  boxFilter(validHeight_.data(), nbSamples, halfWidth, prefix_.data(), smoothed_.data());
+
+  // Search around the last crest, the whole profile when the track is lost or nothing stands out in the window
+  bool windowed = false;
+  if (hasPrevious_ && params_.searchWindow > 0.0) {
+    const double windowMin = previousLateral_ - params_.searchWindow;
+    const double windowMax = previousLateral_ + params_.searchWindow;
+    const auto lo = std::lower_bound(validLateral_.begin(), validLateral_.end(), windowMin);
+    const auto hi = std::upper_bound(validLateral_.begin(), validLateral_.end(), windowMax);
+    const std::size_t windowFirst = std::max<std::size_t>(1, std::distance(validLateral_.begin(), lo));
+    const std::size_t windowEnd = std::min<std::size_t>(nbSamples - 1, std::distance(validLateral_.begin(), hi));
+
+    if (windowFirst < windowEnd) {
+      crest = search_(windowFirst, windowEnd - 1);
+      windowed = true;
+    }
+  }
+  if (!windowed || !crest.valid) {
+    crest = search_(1, nbSamples - 2);
+  }
+
+  // A missed crest loses the track, the next profile is searched whole
+  hasPrevious_ = crest.valid;
+  previousLateral_ = crest.valid ? crest.lateral : previousLateral_;
+  return crest;
+}
+
+Crest CrestDetector::search_(std::size_t first, std::size_t last) const {
+  Crest crest;
+  const std::size_t best =
+      std::distance(smoothed_.begin(), std::max_element(smoothed_.begin() + first, smoothed_.begin() + last + 1));
+
+  // Parabola through the maximum and its neighbours
+  const double y0 = smoothed_[best - 1];
+  const double y1 = smoothed_[best];
+  const double y2 = smoothed_[best + 1];
+  const double curvature = y0 - 2.0 * y1 + y2;
+  const double offset = curvature < 0.0 ? std::clamp(0.5 * (y0 - y2) / curvature, -0.5, 0.5) : 0.0;
+
+  const double spacing = offset > 0.0 ? validLateral_[best + 1] - validLateral_[best]
+                                      : validLateral_[best] - validLateral_[best - 1];
+  crest.lateral = validLateral_[best] + offset * spacing;
+  crest.height = y1 - 0.25 * (y0 - y2) * offset;
+
+  // The crest must stand above the substrate seen on both sides of the profile
+  const double substrate = 0.5 * (smoothed_.front() + smoothed_.back());
+  const double prominence = crest.height - substrate;
+  if (prominence < params_.minProminence) {
+    return crest;
+  }
+
+  crest.valid = true;
+  crest.quality = std::clamp(prominence / params_.maxProminence, 0.0, 1.0);
+  return crest;
+}
+
+} // namespace wp5_seam_tracking
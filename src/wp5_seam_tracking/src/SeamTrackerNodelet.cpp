@@ -0,0 +1,164 @@
+/**
+ * @file SeamTrackerNodelet.cpp
+ * @brief Bead tracking from laser line profiles, streaming path corrections to the controller.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include "wp5_seam_tracking/SeamTrackerNodelet.h"
+
+#include <pluginlib/class_list_macros.h>
+#include <wp5_common/Simd.h>
+#include <wp5_common/TraceRecorder.h>
+#include <wp5_common/Tracing.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace wp5_seam_tracking {
+
+namespace {
+
+std::size_t floatFieldOffset(const sensor_msgs::PointCloud2& cloud, const std::string& name) {
+  for (const sensor_msgs::PointField& field : cloud.fields) {
+    if (field.name != name) {
+      continue;
+    }
+    if (field.datatype != sensor_msgs::PointField::FLOAT32 || field.offset + sizeof(float) > cloud.point_step) {
+      throw std::runtime_error("Field " + name + " is not a float32 of the points.");
+    }
+    return field.offset;
+  }
+  throw std::runtime_error("Field " + name + " does not exist.");
+}
+
+// Row of the profile decoded from its float32 fields, raw loads at the point step rather than the cloud iterators so
+// that the loop vectorizes
+WP5_TARGET_CLONES
+void decodeRow(const std::uint8_t* row,
+               std::size_t nbPoints,
+               std::size_t pointStep,
+               std::size_t lateralOffset,
+               std::size_t heightOffset,
+               double heightSign,
+               double* lateral,
+               double* height) {
+  constexpr double MAX_HEIGHT = std::numeric_limits<double>::max();
+  constexpr double INVALID = std::numeric_limits<double>::quiet_NaN();
+
+  for (std::size_t i = 0; i < nbPoints; ++i) {
+    float x = 0.0F;
+    float z = 0.0F;
+    std::memcpy(&x, row + i * pointStep + lateralOffset, sizeof(float));
+    std::memcpy(&z, row + i * pointStep + heightOffset, sizeof(float));
+    lateral[i] = x;
+
+    // Non finite heights as NaN, compared rather than classified to keep the loop branch free
+    const double value = heightSign * z;
+    height[i] = std::abs(value) <= MAX_HEIGHT ? value : INVALID;
+  }
+}
+
+} // namespace
+
+void SeamTrackerNodelet::onInit() {
+  ros::NodeHandle& nh = getNodeHandle();
+  ros::NodeHandle& pnh = getPrivateNodeHandle();
+
+  // Profile axes, the lateral axis of the profiler is mounted across the path
+  lateralAxis_ = pnh.param<std::string>("lateral_axis", "x");
+  heightAxis_ = pnh.param<std::string>("height_axis", "z");
+  lateralSign_ = pnh.param("lateral_sign", 1.0);
+  heightSign_ = pnh.param("height_sign", -1.0);
+
+  // Crest position when the torch is exactly on the previous bead
+  nominalLateral_ = pnh.param("nominal_lateral", 0.0);
+  nominalHeight_ = pnh.param("nominal_height", 0.0);
+  filterGain_ = std::clamp(pnh.param("filter_gain", 0.5), 0.0, 1.0);
+
+  CrestDetectorParameters params;
+  params.smoothingHalfWidth = static_cast<std::size_t>(pnh.param("detector/smoothing_half_width", 3));
+  params.searchWindow = pnh.param("detector/search_window", params.searchWindow);
+  params.minProminence = pnh.param("detector/min_prominence", params.minProminence);
+  params.maxProminence = pnh.param("detector/max_prominence", params.maxProminence);
+  detector_ = CrestDetector(params);
+
+  profileLoop_ = &metrics_.loop("profile", pnh.param("diagnostics/nominal_rate", 0.0));
+  droppedProfiles_ = &metrics_.drops("profiles");
+  invalidProfiles_ = &metrics_.counter("invalid profiles");
+  missedCrests_ = &metrics_.counter("missed crests");
+  metrics_.advertise(nh, pnh, getName(), "Seam tracker");
+
+  correctionPub_ = nh.advertise<wp5_msgs::PathCorrection>("path_correction", 1);
+  profileSub_ = nh.subscribe(
+      "profile", 1, &SeamTrackerNodelet::profileCallback_, this, ros::TransportHints().tcpNoDelay());
+
+  wp5_common::TraceRecorder::attach(nh);
+}
+
+void SeamTrackerNodelet::profileCallback_(const sensor_msgs::PointCloud2ConstPtr& msg) {
+  WP5_TRACE_SCOPE("scan", "profile");
+  profileLoop_->tick();
+  droppedProfiles_->addSequenceGap(msg->header.seq);
+
+  const std::size_t nbPoints = static_cast<std::size_t>(msg->width) * msg->height;
+  lateral_.resize(nbPoints);
+  height_.resize(nbPoints);
+
+  try {
+    const std::size_t lateralOffset = floatFieldOffset(*msg, lateralAxis_);
+    const std::size_t heightOffset = floatFieldOffset(*msg, heightAxis_);
+    if (msg->row_step < static_cast<std::size_t>(msg->width) * msg->point_step ||
+        msg->data.size() < static_cast<std::size_t>(msg->row_step) * msg->height) {
+      throw std::runtime_error("Data shorter than the cloud dimensions.");
+    }
+
+    for (std::size_t row = 0; row < msg->height; ++row) {
+      decodeRow(msg->data.data() + row * msg->row_step,
+                msg->width,
+                msg->point_step,
+                lateralOffset,
+                heightOffset,
+                heightSign_,
+                lateral_.data() + row * msg->width,
+                height_.data() + row * msg->width);
+    }
+  } catch (const std::runtime_error& e) {
+    NODELET_ERROR_STREAM_THROTTLE(1.0, "[SeamTrackerNodelet] - Invalid profile: " << e.what());
+    invalidProfiles_->add();
+    return;
+  }
+
+  if (nbPoints > 1 && lateral_.front() > lateral_.back()) {
+    std::reverse(lateral_.begin(), lateral_.end());
+    std::reverse(height_.begin(), height_.end());
+  }
+
+  const Crest crest = detector_.detect(lateral_, height_);
+  if (!crest.valid) {
+    missedCrests_->add();
+    return;
+  }
+
+  const double lateral = lateralSign_ * (crest.lateral - nominalLateral_);
+  const double vertical = crest.height - nominalHeight_;
+
+  // First order filter, the controller rate limits on top of it
+  const double gain = hasCorrection_ ? filterGain_ : 1.0;
+  correction_.header = msg->header;
+  correction_.lateral += gain * (lateral - correction_.lateral);
+  correction_.vertical += gain * (vertical - correction_.vertical);
+  correction_.quality = crest.quality;
+  hasCorrection_ = true;
+
+  correctionPub_.publish(correction_);
+}
+
+} // namespace wp5_seam_tracking
+
+PLUGINLIB_EXPORT_CLASS(wp5_seam_tracking::SeamTrackerNodelet, nodelet::Nodelet)
@@ -0,0 +1,99 @@
+/**
+ * @file test_crest_detector.cpp
+ * @brief Unit tests of the crest detection on synthetic laser line profiles.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "wp5_seam_tracking/CrestDetector.h"
+
+namespace wp5_seam_tracking {
+
+namespace {
+
+constexpr std::size_t NB_POINTS = 200;
+constexpr double SPACING = 0.5e-3; // [m]
+
+// Gaussian bead of the given height on a flat substrate, profile from -5 cm to +5 cm
+void makeProfile(double center, double height, std::vector<double>& lateral, std::vector<double>& heights) {
+  lateral.resize(NB_POINTS);
+  heights.resize(NB_POINTS);
+  for (std::size_t i = 0; i < NB_POINTS; ++i) {
+    lateral[i] = -0.05 + i * SPACING;
+    heights[i] = height * std::exp(-std::pow((lateral[i] - center) / 3e-3, 2));
+  }
+}
+
+} // namespace
+
+TEST(CrestDetector, FindsCrestBetweenSamples) {
+  std::vector<double> lateral, heights;
+  makeProfile(1.2e-3, 2e-3, lateral, heights);
+
+  CrestDetector detector;
+  const Crest crest = detector.detect(lateral, heights);
+  ASSERT_TRUE(crest.valid);
+  EXPECT_NEAR(crest.lateral, 1.2e-3, 0.1 * SPACING);
+  EXPECT_GT(crest.quality, 0.0);
+  EXPECT_LE(crest.quality, 1.0);
+}
+
+TEST(CrestDetector, RejectsFlatProfile) {
+  std::vector<double> lateral, heights;
+  makeProfile(0.0, 0.0, lateral, heights);
+
+  CrestDetector detector;
+  EXPECT_FALSE(detector.detect(lateral, heights).valid);
+}
+
+TEST(CrestDetector, SkipsMissingSamples) {
+  std::vector<double> lateral, heights;
+  makeProfile(-2e-3, 2e-3, lateral, heights);
+  for (std::size_t i = 0; i < NB_POINTS; i += 7) {
+    heights[i] = std::numeric_limits<double>::quiet_NaN();
+  }
+
+  CrestDetector detector;
+  const Crest crest = detector.detect(lateral, heights);
+  ASSERT_TRUE(crest.valid);
+  EXPECT_NEAR(crest.lateral, -2e-3, SPACING);
+}
+
+TEST(CrestDetector, SearchesWholeProfileWhenCrestLeavesWindow) {
+  std::vector<double> lateral, heights;
+  CrestDetector detector;
+
+  makeProfile(0.0, 2e-3, lateral, heights);
+  ASSERT_TRUE(detector.detect(lateral, heights).valid);
+
+  // Beyond the 1 cm search window around the last crest
+  makeProfile(0.03, 2e-3, lateral, heights);
+  const Crest crest = detector.detect(lateral, heights);
+  ASSERT_TRUE(crest.valid);
+  EXPECT_NEAR(crest.lateral, 0.03, SPACING);
+}
+
+TEST(CrestDetector, RecoversAfterMissedProfile) {
+  std::vector<double> lateral, heights;
+  CrestDetector detector;
+
+  makeProfile(0.0, 2e-3, lateral, heights);
+  ASSERT_TRUE(detector.detect(lateral, heights).valid);
+
+  makeProfile(0.0, 0.0, lateral, heights);
+  ASSERT_FALSE(detector.detect(lateral, heights).valid);
+
+  makeProfile(-0.03, 2e-3, lateral, heights);
+  const Crest crest = detector.detect(lateral, heights);
+  ASSERT_TRUE(crest.valid);
+  EXPECT_NEAR(crest.lateral, -0.03, SPACING);
+}
+
+} // namespace wp5_seam_tracking
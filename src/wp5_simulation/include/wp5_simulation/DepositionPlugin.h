@@ -0,0 +1,97 @@
+/**
+ * @file DepositionPlugin.h
+ * @brief Gazebo world plugin growing the part along the torch path while the arc is on.
+ *
+ * On every physics step the torch tip is expressed in the part frame and the bead swept since the previous step is
+ * added to the part heightmap, with a cross-section given by the wire feed and the travel speed. Only the tiles
+ * modified since the last publication are re-meshed and published as markers, so the cost of a step does not depend
+ * on the size of the part and builds can be simulated faster than real time.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <ros/callback_queue.h>
+#include <ros/ros.h>
+#include <std_msgs/Bool.h>
+#include <std_srvs/Empty.h>
+#include <visualization_msgs/MarkerArray.h>
+#include <wp5_common/Metrics.h>
+
+#include <Eigen/Core>
+#include <atomic>
+#include <gazebo/common/Plugin.hh>
+#include <gazebo/physics/physics.hh>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "wp5_simulation/HeightmapRegistry.h"
+
+namespace wp5_simulation {
+
+class DepositionPlugin : public gazebo::WorldPlugin {
+public:
+  ~DepositionPlugin() override;
+
+  void Load(gazebo::physics::WorldPtr world, sdf::ElementPtr sdf) override;
+
+private:
+  void onUpdate_(const gazebo::common::UpdateInfo& info);
+
+  // Links are spawned after the world, they are looked up until found
+  bool resolveLinks_();
+  Eigen::Vector3d torchInPart_() const;
+
+  void arcStateCallback_(const std_msgs::BoolConstPtr& msg);
+  bool resetCallback_(std_srvs::Empty::Request& req, std_srvs::Empty::Response& res);
+  void publishMarkers_(const ros::WallTimerEvent& event);
+  visualization_msgs::Marker tileMarker_(const Heightmap& heightmap, std::size_t tile) const;
+
+  gazebo::physics::WorldPtr world_;
+  gazebo::event::ConnectionPtr updateConnection_;
+
+  std::string torchLinkName_;
+  std::string partLinkName_;
+  gazebo::physics::LinkPtr torchLink_;
+  gazebo::physics::LinkPtr partLink_;
+  ignition::math::Vector3d tcpOffset_;
+
+  std::string heightmapName_;
+  std::shared_ptr<SharedHeightmap> heightmap_;
+
+  // Bead model
+  double beadWidth_ = 6e-3;      // [m]
+  double wireFeedSpeed_ = 0.1;   // [m/s]
+  double wireDiameter_ = 1.2e-3; // [m]
+  double maxBeadHeight_ = 4e-3;  // [m]
+  double minTravelSpeed_ = 1e-3; // Below this speed the bead is as high as when moving at it [m/s]
+  double maxStandoff_ = 0.025;   // No arc above this distance to the surface [m]
+
+  // Physics thread
+  bool hasPrevious_ = false;
+  Eigen::Vector3d previousTip_;
+  double previousTime_ = 0.0;
+
+  std::atomic<bool> arcOn_{false};
+  std::atomic<bool> newBead_{false};
+
+  // Wall time rates and durations, the physics steps run at the real time factor
+  wp5_common::MetricsRegistry metrics_;
+  wp5_common::LoopMetric* stepLoop_ = nullptr;
+  wp5_common::Histogram* depositDuration_ = nullptr;
+  wp5_common::Histogram* markersDuration_ = nullptr;
+
+  std::unique_ptr<ros::NodeHandle> nh_;
+  ros::CallbackQueue queue_;
+  std::thread queueThread_;
+  ros::Subscriber arcStateSub_;
+  ros::ServiceServer resetService_;
+  ros::Publisher markerPub_;
+  ros::WallTimer markerTimer_;
+  std::string frameId_;
+};
+
+} // namespace wp5_simulation
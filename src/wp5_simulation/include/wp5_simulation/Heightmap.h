@@ -0,0 +1,105 @@
+/**
+ * @file Heightmap.h
+ * @brief Heightmap of the simulated part, grown bead by bead along the torch path.
+ *
+ * The grid is split in square tiles. Each deposit only visits the cells under the swept bead footprint and flags their
+ * tiles as dirty, so consumers rebuild the geometry of the modified tiles only. The maximum height of each tile is kept
+ * up to date, so ray casts skip the tiles they pass above.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace wp5_simulation {
+
+struct HeightmapParameters {
+  double resolution = 5e-4;             // Cell size [m]
+  Eigen::Vector2d origin{-0.25, -0.25}; // Corner of the grid in the part frame [m]
+  Eigen::Vector2d size{0.5, 0.5};       // [m]
+  double baseHeight = 0.0;              // Substrate top surface [m]
+  std::size_t tileSize = 32;            // Cells along each side of a tile
+};
+
+/**
+ * @brief Parabolic bead cross-section.
+ */
+struct BeadGeometry {
+  double width = 6e-3;  // [m]
+  double height = 2e-3; // [m]
+};
+
+class Heightmap {
+public:
+  explicit Heightmap(const HeightmapParameters& params = HeightmapParameters());
+
+  /**
+   * @brief Back to the bare substrate, every tile is flagged dirty.
+   */
+  void reset();
+
+  /**
+   * @brief Start a new bead, deposited on top of the current surface.
+   */
+  void startBead() { ++currentBead_; }
+
+  /**
+   * @brief Deposit the bead swept between two torch positions, in the part frame.
+   *
+   * Cells keep the surface they had when the current bead first reached them, the bead profile is laid on top of it,
+   * so consecutive overlapping segments of a bead do not stack up.
+   */
+  void depositSegment(const Eigen::Vector2d& from, const Eigen::Vector2d& to, const BeadGeometry& bead);
+
+  /**
+   * @brief Height at a point of the part frame, bilinear between cell centers, base height outside of the grid.
+   */
+  double height(const Eigen::Vector2d& point) const;
+
+  double cellHeight(std::size_t ix, std::size_t iy) const { return heights_[iy * nbCellsX_ + ix]; }
+  Eigen::Vector2d cellCenter(std::size_t ix, std::size_t iy) const {
+    return params_.origin + params_.resolution * Eigen::Vector2d(ix + 0.5, iy + 0.5);
+  }
+
+  double tileMaxHeight(std::size_t tile) const { return tileMax_[tile]; }
+  double maxHeight() const { return maxHeight_; }
+
+  std::size_t getNbCellsX() const { return nbCellsX_; }
+  std::size_t getNbCellsY() const { return nbCellsY_; }
+  std::size_t getNbTilesX() const { return nbTilesX_; }
+  std::size_t getNbTilesY() const { return nbTilesY_; }
+  const HeightmapParameters& getParameters() const { return params_; }
+
+  /**
+   * @brief Tiles modified since the last call, cleared on return.
+   */
+  std::vector<std::size_t> takeDirtyTiles();
+
+private:
+  void markDirty_(std::size_t ix, std::size_t iy);
+
+  HeightmapParameters params_;
+  std::size_t nbCellsX_ = 0;
+  std::size_t nbCellsY_ = 0;
+  std::size_t nbTilesX_ = 0;
+  std::size_t nbTilesY_ = 0;
+
+  std::vector<float> heights_;
+  std::vector<float> beadBase_;     // Surface under the bead that last reached each cell
+  std::vector<std::uint32_t> bead_; // Bead that last reached each cell
+  std::uint32_t currentBead_ = 1;
+
+  std::vector<float> tileMax_;
+  float maxHeight_ = 0.0f;
+
+  std::vector<std::uint8_t> dirty_;
+  std::vector<std::size_t> dirtyTiles_;
+};
+
+} // namespace wp5_simulation
@@ -0,0 +1,55 @@
+/**
+ * @file HeightmapRaycaster.h
+ * @brief Ray casting against the part heightmap on the CPU, for simulated range sensors.
+ *
+ * Rays are clipped to the grid and to its highest point, then walked tile by tile: a tile is only entered cell by cell
+ * when the ray goes below its maximum height, so a ray usually visits a handful of cells. In a cell the surface is
+ * bilinear between the four cell centers, quadratic along the ray, and intersected exactly. Outside of the grid, the
+ * substrate is an infinite plane at the base height.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include "wp5_simulation/Heightmap.h"
+
+namespace wp5_simulation {
+
+class HeightmapRaycaster {
+public:
+  /**
+   * @brief Distance along a ray of the part frame to the surface.
+   *
+   * @param direction Unit direction.
+   * @return False when nothing is hit within maxRange.
+   */
+  static bool raycast(const Heightmap& heightmap,
+                      const Eigen::Vector3d& origin,
+                      const Eigen::Vector3d& direction,
+                      double maxRange,
+                      double& range);
+
+  /**
+   * @brief Cast a fan of rays sharing the sensor origin.
+   *
+   * @param sensor Pose of the sensor in the part frame.
+   * @param directions Unit directions of the rays in the sensor frame.
+   * @param ranges Distance of each ray, NaN when nothing is hit between minRange and maxRange.
+   */
+  void castFan(const Heightmap& heightmap,
+               const Eigen::Isometry3d& sensor,
+               const Eigen::Matrix3Xd& directions,
+               double minRange,
+               double maxRange,
+               Eigen::ArrayXd& ranges);
+
+private:
+  Eigen::Matrix3Xd partDirections_;
+};
+
+} // namespace wp5_simulation
@@ -0,0 +1,53 @@
+/**
+ * @file HeightmapRegistry.h
+ * @brief Heightmaps of the simulated parts, shared between the plugins of a Gazebo server.
+ *
+ * The deposition plugin writes a heightmap from the physics update while sensor plugins read it from their own
+ * thread, so each heightmap comes with its reader/writer lock.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+
+#include "wp5_simulation/Heightmap.h"
+
+namespace wp5_simulation {
+
+struct SharedHeightmap {
+  explicit SharedHeightmap(const HeightmapParameters& params) : heightmap(params) {}
+
+  mutable std::shared_mutex mutex;
+  Heightmap heightmap;
+};
+
+class HeightmapRegistry {
+public:
+  /**
+   * @brief Single instance of the process, defined in the library so all plugins share it.
+   */
+  static HeightmapRegistry& instance();
+
+  void add(const std::string& name, const std::shared_ptr<SharedHeightmap>& heightmap);
+  void remove(const std::string& name);
+
+  /**
+   * @brief Heightmap registered under that name, null until the owning plugin is loaded.
+   */
+  std::shared_ptr<SharedHeightmap> find(const std::string& name) const;
+
+private:
+  HeightmapRegistry() = default;
+
+  mutable std::mutex mutex_;
+  std::map<std::string, std::shared_ptr<SharedHeightmap>> heightmaps_;
+};
+
+} // namespace wp5_simulation
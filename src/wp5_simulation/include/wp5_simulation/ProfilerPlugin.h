@@ -0,0 +1,75 @@
+/**
+ * @file ProfilerPlugin.h
+ * @brief Gazebo model plugin simulating the laser line profiler on the CPU.
+ *
+ * The laser fan is cast against the heightmap of the simulated part, shared by the deposition plugin, so no GPU
+ * rendering is needed and the profiles follow the part as it grows. Points hidden from the camera by the part are
+ * dropped like on the real triangulation sensor and range noise is added. Profiles are published as PointCloud2 in
+ * the profiler frame, the lateral axis along x and the range along z, as expected by wp5_seam_tracking.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <ros/ros.h>
+#include <sensor_msgs/PointCloud2.h>
+#include <wp5_common/Metrics.h>
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+#include <gazebo/common/Plugin.hh>
+#include <gazebo/physics/physics.hh>
+#include <memory>
+#include <random>
+#include <string>
+
+#include "wp5_simulation/HeightmapRaycaster.h"
+#include "wp5_simulation/HeightmapRegistry.h"
+
+namespace wp5_simulation {
+
+class ProfilerPlugin : public gazebo::ModelPlugin {
+public:
+  void Load(gazebo::physics::ModelPtr model, sdf::ElementPtr sdf) override;
+
+private:
+  void onUpdate_(const gazebo::common::UpdateInfo& info);
+
+  // The part and its heightmap may be loaded after the profiler, they are looked up until found
+  bool resolve_();
+
+  gazebo::physics::WorldPtr world_;
+  gazebo::physics::LinkPtr link_;
+  gazebo::event::ConnectionPtr updateConnection_;
+
+  std::string partLinkName_;
+  gazebo::physics::LinkPtr partLink_;
+  std::string heightmapName_;
+  std::shared_ptr<SharedHeightmap> heightmap_;
+
+  double period_ = 1.0 / 300.0; // [s]
+  double lastScan_ = -1.0;
+  double minRange_ = 0.05;      // [m]
+  double maxRange_ = 0.3;       // [m]
+  double noiseStddev_ = 2e-5;   // [m]
+  Eigen::Vector3d cameraOffset_ = Eigen::Vector3d::Zero();
+
+  Eigen::Matrix3Xd directions_;
+  HeightmapRaycaster raycaster_;
+  Eigen::ArrayXd ranges_;
+  std::mt19937 generator_;
+  std::normal_distribution<double> noise_;
+
+  // Wall time rates and durations, the scans run at the real time factor
+  wp5_common::MetricsRegistry metrics_;
+  wp5_common::LoopMetric* scanLoop_ = nullptr;
+  wp5_common::Histogram* scanDuration_ = nullptr;
+
+  std::unique_ptr<ros::NodeHandle> nh_;
+  ros::Publisher profilePub_;
+  sensor_msgs::PointCloud2 profile_;
+};
+
+} // namespace wp5_simulation
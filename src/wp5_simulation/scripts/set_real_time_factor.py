@@ -0,0 +1,46 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+# Set the target real-time factor of Gazebo, once its physics services are up.
+# Author: lmunier - <lmunier@protonmail.com>
+# Date: 2026-10-17
+#
+# Gazebo runs max_update_rate steps of step_size per second, a real-time factor of 0 removes the limit and steps as
+# fast as the CPU allows.
+
+import rospy
+from gazebo_msgs.srv import GetPhysicsProperties, SetPhysicsProperties
+
+
+def main():
+    rospy.init_node("set_real_time_factor")
+    real_time_factor = rospy.get_param("~real_time_factor", 0.0)
+    step_size = rospy.get_param("~step_size", 0.001)
+
+    rospy.wait_for_service("/gazebo/get_physics_properties")
+    rospy.wait_for_service("/gazebo/set_physics_properties")
+    get_properties = rospy.ServiceProxy("/gazebo/get_physics_properties", GetPhysicsProperties)
+    set_properties = rospy.ServiceProxy("/gazebo/set_physics_properties", SetPhysicsProperties)
+
+    properties = get_properties()
+    max_update_rate = real_time_factor / step_size if real_time_factor > 0.0 else 0.0
+    response = set_properties(
+        time_step=step_size,
+        max_update_rate=max_update_rate,
+        gravity=properties.gravity,
+        ode_config=properties.ode_config,
+    )
+
+    if not response.success:
+        rospy.logerr("[set_real_time_factor] - %s", response.status_message)
+        return
+
+    rospy.loginfo(
+        "[set_real_time_factor] - Step of %g s, %s.",
+        step_size,
+        "real-time factor %g" % real_time_factor if real_time_factor > 0.0 else "no real-time limit",
+    )
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,270 @@
+/**
+ * @file DepositionPlugin.cpp
+ * @brief Gazebo world plugin growing the part along the torch path while the arc is on.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include "wp5_simulation/DepositionPlugin.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <vector>
+
+namespace wp5_simulation {
+
+namespace {
+
+template <typename T>
+T sdfParam(const sdf::ElementPtr& sdf, const std::string& name, const T& fallback) {
+  return sdf->Get<T>(name, fallback).first;
+}
+
+} // namespace
+
+DepositionPlugin::~DepositionPlugin() {
+  updateConnection_.reset();
+
+  if (nh_) {
+    nh_->shutdown();
+    queue_.disable();
+    queueThread_.join();
+  }
+  HeightmapRegistry::instance().remove(heightmapName_);
+}
+
+void DepositionPlugin::Load(gazebo::physics::WorldPtr world, sdf::ElementPtr sdf) {
+  if (!ros::isInitialized()) {
+    ROS_FATAL("[DepositionPlugin] - ROS is not initialized, load the plugin through gazebo_ros.");
+    return;
+  }
+
+  world_ = world;
+  torchLinkName_ = sdfParam<std::string>(sdf, "torch_link", "cell::tool0");
+  partLinkName_ = sdfParam<std::string>(sdf, "part_link", "");
+  tcpOffset_ = sdfParam(sdf, "tcp_offset", ignition::math::Vector3d::Zero);
+
+  HeightmapParameters params;
+  params.resolution = sdfParam(sdf, "resolution", params.resolution);
+  const ignition::math::Vector2d origin = sdfParam(sdf, "origin", ignition::math::Vector2d(-0.25, -0.25));
+  const ignition::math::Vector2d size = sdfParam(sdf, "size", ignition::math::Vector2d(0.5, 0.5));
+  params.origin = Eigen::Vector2d(origin.X(), origin.Y());
+  params.size = Eigen::Vector2d(size.X(), size.Y());
+  params.baseHeight = sdfParam(sdf, "base_height", params.baseHeight);
+  params.tileSize = static_cast<std::size_t>(sdfParam(sdf, "tile_size", 32));
+
+  beadWidth_ = sdfParam(sdf, "bead_width", beadWidth_);
+  wireFeedSpeed_ = sdfParam(sdf, "wire_feed_speed", wireFeedSpeed_);
+  wireDiameter_ = sdfParam(sdf, "wire_diameter", wireDiameter_);
+  maxBeadHeight_ = sdfParam(sdf, "max_bead_height", maxBeadHeight_);
+  minTravelSpeed_ = std::max(1e-6, sdfParam(sdf, "min_travel_speed", minTravelSpeed_));
+  maxStandoff_ = sdfParam(sdf, "max_standoff", maxStandoff_);
+
+  // Shared with the sensor plugins through the registry
+  heightmapName_ = sdfParam<std::string>(sdf, "heightmap_name", "part");
+  heightmap_ = std::make_shared<SharedHeightmap>(params);
+  HeightmapRegistry::instance().add(heightmapName_, heightmap_);
+
+  frameId_ = sdfParam<std::string>(sdf, "frame_id", "world");
+  const double markerRate = sdfParam(sdf, "marker_rate", 5.0);
+
+  nh_ = std::make_unique<ros::NodeHandle>(sdfParam<std::string>(sdf, "robot_namespace", "/"));
+  nh_->setCallbackQueue(&queue_);
+
+  arcStateSub_ = nh_->subscribe(
+      "arc_state", 8, &DepositionPlugin::arcStateCallback_, this, ros::TransportHints().tcpNoDelay());
+  resetService_ = nh_->advertiseService("deposition/reset", &DepositionPlugin::resetCallback_, this);
+  markerPub_ = nh_->advertise<visualization_msgs::MarkerArray>("deposition/markers", 1, true);
+  if (markerRate > 0.0) {
+    markerTimer_ = nh_->createWallTimer(ros::WallDuration(1.0 / markerRate), &DepositionPlugin::publishMarkers_, this);
+  }
+
+  // Reported from the queue of the plugin
+  ros::NodeHandle pnh(*nh_, "deposition");
+  stepLoop_ = &metrics_.loop("physics steps");
+  depositDuration_ = &metrics_.histogram("deposit");
+  markersDuration_ = &metrics_.histogram("markers");
+  metrics_.advertise(*nh_, pnh, ros::this_node::getName(), "Deposition plugin");
+
+  queueThread_ = std::thread([this]() {
+    while (nh_->ok()) {
+      queue_.callAvailable(ros::WallDuration(0.01));
+    }
+  });
+
+  updateConnection_ = gazebo::event::Events::ConnectWorldUpdateBegin(
+      std::bind(&DepositionPlugin::onUpdate_, this, std::placeholders::_1));
+
+  ROS_INFO_STREAM("[DepositionPlugin] - Heightmap " << heightmapName_ << " of " << heightmap_->heightmap.getNbCellsX()
+                                                    << "x" << heightmap_->heightmap.getNbCellsY() << " cells, torch "
+                                                    << torchLinkName_ << ".");
+}
+
+bool DepositionPlugin::resolveLinks_() {
+  if (!torchLink_) {
+    torchLink_ = boost::dynamic_pointer_cast<gazebo::physics::Link>(world_->EntityByName(torchLinkName_));
+  }
+  if (!partLinkName_.empty() && !partLink_) {
+    partLink_ = boost::dynamic_pointer_cast<gazebo::physics::Link>(world_->EntityByName(partLinkName_));
+  }
+  return torchLink_ && (partLinkName_.empty() || partLink_);
+}
+
+Eigen::Vector3d DepositionPlugin::torchInPart_() const {
+  const ignition::math::Pose3d torch = torchLink_->WorldPose();
+  ignition::math::Vector3d tip = torch.Pos() + torch.Rot().RotateVector(tcpOffset_);
+
+  // The part moves with the positioner
+  if (partLink_) {
+    const ignition::math::Pose3d part = partLink_->WorldPose();
+    tip = part.Rot().RotateVectorReverse(tip - part.Pos());
+  }
+  return Eigen::Vector3d(tip.X(), tip.Y(), tip.Z());
+}
+
+void DepositionPlugin::onUpdate_(const gazebo::common::UpdateInfo& info) {
+  stepLoop_->tick();
+  if (!resolveLinks_()) {
+    return;
+  }
+
+  const Eigen::Vector3d tip = torchInPart_();
+  const double time = info.simTime.Double();
+
+  if (!arcOn_.load()) {
+    hasPrevious_ = false;
+    return;
+  }
+
+  if (newBead_.exchange(false) || !hasPrevious_) {
+    std::unique_lock<std::shared_mutex> lock(heightmap_->mutex);
+    heightmap_->heightmap.startBead();
+    hasPrevious_ = true;
+    previousTip_ = tip;
+    previousTime_ = time;
+    return;
+  }
+
+  const double dt = time - previousTime_;
+  if (dt <= 0.0) {
+    return;
+  }
+
+  // Deposited cross-section from the wire volume fed while travelling, on a parabolic profile
+  const double travel = (tip - previousTip_).head<2>().norm();
+  const double wireArea = 0.25 * M_PI * wireDiameter_ * wireDiameter_;
+  const double area = wireFeedSpeed_ * wireArea / std::max(travel / dt, minTravelSpeed_);
+
+  BeadGeometry bead;
+  bead.width = beadWidth_;
+  bead.height = std::min(1.5 * area / beadWidth_, maxBeadHeight_);
+
+  {
+    const ros::WallTime start = ros::WallTime::now();
+    std::unique_lock<std::shared_mutex> lock(heightmap_->mutex);
+
+    // The arc cannot bridge a torch too far from the surface
+    if (tip.z() - heightmap_->heightmap.height(tip.head<2>()) <= maxStandoff_) {
+      heightmap_->heightmap.depositSegment(previousTip_.head<2>(), tip.head<2>(), bead);
+    }
+    depositDuration_->record(static_cast<std::uint64_t>((ros::WallTime::now() - start).toNSec()));
+  }
+
+  previousTip_ = tip;
+  previousTime_ = time;
+}
+
+void DepositionPlugin::arcStateCallback_(const std_msgs::BoolConstPtr& msg) {
+  if (msg->data && !arcOn_.load()) {
+    newBead_.store(true);
+  }
+  arcOn_.store(msg->data);
+}
+
+bool DepositionPlugin::resetCallback_(std_srvs::Empty::Request& /*req*/, std_srvs::Empty::Response& /*res*/) {
+  {
+    std::unique_lock<std::shared_mutex> lock(heightmap_->mutex);
+    heightmap_->heightmap.reset();
+  }
+  newBead_.store(true);
+  return true;
+}
+
+void DepositionPlugin::publishMarkers_(const ros::WallTimerEvent& /*event*/) {
+  const ros::WallTime start = ros::WallTime::now();
+  visualization_msgs::MarkerArray markers;
+
+  {
+    std::unique_lock<std::shared_mutex> lock(heightmap_->mutex);
+    const std::vector<std::size_t> tiles = heightmap_->heightmap.takeDirtyTiles();
+    if (tiles.empty()) {
+      return;
+    }
+
+    markers.markers.reserve(tiles.size());
+    for (std::size_t tile : tiles) {
+      markers.markers.push_back(tileMarker_(heightmap_->heightmap, tile));
+    }
+  }
+
+  markerPub_.publish(markers);
+  markersDuration_->record(static_cast<std::uint64_t>((ros::WallTime::now() - start).toNSec()));
+}
+
+visualization_msgs::Marker DepositionPlugin::tileMarker_(const Heightmap& heightmap, std::size_t tile) const {
+  const HeightmapParameters& params = heightmap.getParameters();
+  const std::size_t firstX = (tile % heightmap.getNbTilesX()) * params.tileSize;
+  const std::size_t firstY = (tile / heightmap.getNbTilesX()) * params.tileSize;
+  const std::size_t endX = std::min(firstX + params.tileSize, heightmap.getNbCellsX() - 1);
+  const std::size_t endY = std::min(firstY + params.tileSize, heightmap.getNbCellsY() - 1);
+
+  visualization_msgs::Marker marker;
+  marker.header.frame_id = frameId_;
+  marker.header.stamp = ros::Time::now();
+  marker.ns = "deposition";
+  marker.id = static_cast<int>(tile);
+  marker.type = visualization_msgs::Marker::TRIANGLE_LIST;
+  marker.pose.orientation.w = 1.0;
+  marker.scale.x = marker.scale.y = marker.scale.z = 1.0;
+  marker.color.r = 0.75f;
+  marker.color.g = 0.75f;
+  marker.color.b = 0.8f;
+  marker.color.a = 1.0f;
+
+  auto vertex = [&heightmap](std::size_t ix, std::size_t iy) {
+    const Eigen::Vector2d center = heightmap.cellCenter(ix, iy);
+    geometry_msgs::Point point;
+    point.x = center.x();
+    point.y = center.y();
+    point.z = heightmap.cellHeight(ix, iy);
+    return point;
+  };
+
+  // Two triangles between four cell centers, the bare substrate is left out
+  const double substrate = params.baseHeight + 1e-6;
+  for (std::size_t iy = firstY; iy < endY; ++iy) {
+    for (std::size_t ix = firstX; ix < endX; ++ix) {
+      if (std::max({heightmap.cellHeight(ix, iy),
+                    heightmap.cellHeight(ix + 1, iy),
+                    heightmap.cellHeight(ix, iy + 1),
+                    heightmap.cellHeight(ix + 1, iy + 1)}) <= substrate) {
+        continue;
+      }
+
+      const geometry_msgs::Point p00 = vertex(ix, iy);
+      const geometry_msgs::Point p10 = vertex(ix + 1, iy);
+      const geometry_msgs::Point p01 = vertex(ix, iy + 1);
+      const geometry_msgs::Point p11 = vertex(ix + 1, iy + 1);
+      marker.points.insert(marker.points.end(), {p00, p10, p11, p00, p11, p01});
+    }
+  }
+
+  marker.action = marker.points.empty() ? visualization_msgs::Marker::DELETE : visualization_msgs::Marker::ADD;
+  return marker;
+}
+
+GZ_REGISTER_WORLD_PLUGIN(DepositionPlugin)
+
+} // namespace wp5_simulation
@@ -0,0 +1,152 @@
+/**
+ * @file Heightmap.cpp
+ * @brief Heightmap of the simulated part, grown bead by bead along the torch path.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include "wp5_simulation/Heightmap.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace wp5_simulation {
+
+Heightmap::Heightmap(const HeightmapParameters& params) : params_(params) {
+  if (params_.resolution <= 0.0 || params_.tileSize == 0) {
+    throw std::invalid_argument("[Heightmap] - Resolution and tile size must be positive.");
+  }
+
+  nbCellsX_ = static_cast<std::size_t>(std::ceil(params_.size.x() / params_.resolution));
+  nbCellsY_ = static_cast<std::size_t>(std::ceil(params_.size.y() / params_.resolution));
+  if (nbCellsX_ < 2 || nbCellsY_ < 2) {
+    throw std::invalid_argument("[Heightmap] - At least two cells needed along each axis.");
+  }
+  nbTilesX_ = (nbCellsX_ + params_.tileSize - 1) / params_.tileSize;
+  nbTilesY_ = (nbCellsY_ + params_.tileSize - 1) / params_.tileSize;
+
+  heights_.resize(nbCellsX_ * nbCellsY_);
+  beadBase_.resize(nbCellsX_ * nbCellsY_);
+  bead_.resize(nbCellsX_ * nbCellsY_);
+  tileMax_.resize(nbTilesX_ * nbTilesY_);
+  dirty_.resize(nbTilesX_ * nbTilesY_);
+  dirtyTiles_.reserve(nbTilesX_ * nbTilesY_);
+
+  reset();
+}
+
+void Heightmap::reset() {
+  std::fill(heights_.begin(), heights_.end(), static_cast<float>(params_.baseHeight));
+  std::fill(beadBase_.begin(), beadBase_.end(), static_cast<float>(params_.baseHeight));
+  std::fill(bead_.begin(), bead_.end(), 0);
+  std::fill(tileMax_.begin(), tileMax_.end(), static_cast<float>(params_.baseHeight));
+  maxHeight_ = static_cast<float>(params_.baseHeight);
+  currentBead_ = 1;
+
+  dirtyTiles_.clear();
+  for (std::size_t tile = 0; tile < dirty_.size(); ++tile) {
+    dirty_[tile] = 1;
+    dirtyTiles_.push_back(tile);
+  }
+}
+
+void Heightmap::depositSegment(const Eigen::Vector2d& from, const Eigen::Vector2d& to, const BeadGeometry& bead) {
+  const double radius = 0.5 * bead.width;
+  if (radius <= 0.0 || bead.height <= 0.0) {
+    return;
+  }
+
+  // Cells whose center can be reached by the footprint
+  const Eigen::Vector2d margin = Eigen::Vector2d::Constant(radius);
+  const Eigen::Vector2d lower = (from.cwiseMin(to) - margin - params_.origin) / params_.resolution;
+  const Eigen::Vector2d upper = (from.cwiseMax(to) + margin - params_.origin) / params_.resolution;
+  if (upper.x() < 0.0 || upper.y() < 0.0 || lower.x() >= nbCellsX_ || lower.y() >= nbCellsY_) {
+    return;
+  }
+
+  const std::size_t minX = static_cast<std::size_t>(std::max(0.0, std::floor(lower.x())));
+  const std::size_t minY = static_cast<std::size_t>(std::max(0.0, std::floor(lower.y())));
+  const std::size_t maxX = std::min(nbCellsX_ - 1, static_cast<std::size_t>(upper.x()));
+  const std::size_t maxY = std::min(nbCellsY_ - 1, static_cast<std::size_t>(upper.y()));
+
+  const Eigen::Vector2d segment = to - from;
+  const double squaredLength = segment.squaredNorm();
+  const double squaredRadius = radius * radius;
+
+  for (std::size_t iy = minY; iy <= maxY; ++iy) {
+    for (std::size_t ix = minX; ix <= maxX; ++ix) {
+      const Eigen::Vector2d center = cellCenter(ix, iy);
+      const double ratio =
+          squaredLength > 0.0 ? std::clamp((center - from).dot(segment) / squaredLength, 0.0, 1.0) : 0.0;
+      const double squaredDistance = (from + ratio * segment - center).squaredNorm();
+      if (squaredDistance >= squaredRadius) {
+        continue;
+      }
+
+      const std::size_t index = iy * nbCellsX_ + ix;
+      if (bead_[index] != currentBead_) {
+        bead_[index] = currentBead_;
+        beadBase_[index] = heights_[index];
+      }
+
+      const float target =
+          beadBase_[index] + static_cast<float>(bead.height * (1.0 - squaredDistance / squaredRadius));
+      if (target > heights_[index]) {
+        heights_[index] = target;
+        markDirty_(ix, iy);
+
+        float& tileMax = tileMax_[(iy / params_.tileSize) * nbTilesX_ + ix / params_.tileSize];
+        tileMax = std::max(tileMax, target);
+        maxHeight_ = std::max(maxHeight_, target);
+      }
+    }
+  }
+}
+
+double Heightmap::height(const Eigen::Vector2d& point) const {
+  const Eigen::Vector2d grid = (point - params_.origin) / params_.resolution - Eigen::Vector2d::Constant(0.5);
+  if (grid.x() < 0.0 || grid.y() < 0.0 || grid.x() > nbCellsX_ - 1 || grid.y() > nbCellsY_ - 1) {
+    return params_.baseHeight;
+  }
+
+  const std::size_t ix = std::min(static_cast<std::size_t>(grid.x()), nbCellsX_ - 2);
+  const std::size_t iy = std::min(static_cast<std::size_t>(grid.y()), nbCellsY_ - 2);
+  const double fx = grid.x() - ix;
+  const double fy = grid.y() - iy;
+
+  return (1.0 - fy) * ((1.0 - fx) * cellHeight(ix, iy) + fx * cellHeight(ix + 1, iy)) +
+         fy * ((1.0 - fx) * cellHeight(ix, iy + 1) + fx * cellHeight(ix + 1, iy + 1));
+}
+
+std::vector<std::size_t> Heightmap::takeDirtyTiles() {
+  std::vector<std::size_t> tiles;
+  tiles.swap(dirtyTiles_);
+  dirtyTiles_.reserve(dirty_.size());
+
+  for (std::size_t tile : tiles) {
+    dirty_[tile] = 0;
+  }
+  return tiles;
+}
+
+void Heightmap::markDirty_(std::size_t ix, std::size_t iy) {
+  // A cell on the lower edge of a tile is also a corner of the geometry of the previous tile
+  const std::size_t tileX = ix / params_.tileSize;
+  const std::size_t tileY = iy / params_.tileSize;
+  const std::size_t firstX = (ix % params_.tileSize == 0 && tileX > 0) ? tileX - 1 : tileX;
+  const std::size_t firstY = (iy % params_.tileSize == 0 && tileY > 0) ? tileY - 1 : tileY;
+
+  for (std::size_t ty = firstY; ty <= tileY; ++ty) {
+    for (std::size_t tx = firstX; tx <= tileX; ++tx) {
+      const std::size_t tile = ty * nbTilesX_ + tx;
+      if (!dirty_[tile]) {
+        dirty_[tile] = 1;
+        dirtyTiles_.push_back(tile);
+      }
+    }
+  }
+}
+
+} // namespace wp5_simulation
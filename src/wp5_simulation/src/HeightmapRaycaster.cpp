@@ -0,0 +1,242 @@
+/**
+ * @file HeightmapRaycaster.cpp
+ * @brief Ray casting against the part heightmap on the CPU, for simulated range sensors.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include "wp5_simulation/HeightmapRaycaster.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace wp5_simulation {
+
+namespace {
+
+constexpr double INF = std::numeric_limits<double>::infinity();
+
+/**
+ * @brief Walk the unit cells of a grid crossed by a ray between two ray parameters, until visit returns true.
+ *
+ * @param start Ray origin in grid coordinates.
+ * @param direction Ray direction in grid units per ray parameter.
+ */
+template <typename Visit>
+bool walkGrid(const Eigen::Vector2d& start,
+              const Eigen::Vector2d& direction,
+              double tBegin,
+              double tEnd,
+              std::size_t nbX,
+              std::size_t nbY,
+              Visit&& visit) {
+  const Eigen::Vector2d entry = start + tBegin * direction;
+  std::ptrdiff_t cell[2] = {
+      std::clamp<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(std::floor(entry.x())), 0, nbX - 1),
+      std::clamp<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(std::floor(entry.y())), 0, nbY - 1)};
+  const std::ptrdiff_t size[2] = {static_cast<std::ptrdiff_t>(nbX), static_cast<std::ptrdiff_t>(nbY)};
+
+  std::ptrdiff_t step[2];
+  double tNext[2], tDelta[2];
+  for (int axis = 0; axis < 2; ++axis) {
+    if (direction[axis] > 0.0) {
+      step[axis] = 1;
+      tNext[axis] = (cell[axis] + 1 - start[axis]) / direction[axis];
+      tDelta[axis] = 1.0 / direction[axis];
+    } else if (direction[axis] < 0.0) {
+      step[axis] = -1;
+      tNext[axis] = (cell[axis] - start[axis]) / direction[axis];
+      tDelta[axis] = -1.0 / direction[axis];
+    } else {
+      step[axis] = 0;
+      tNext[axis] = INF;
+      tDelta[axis] = INF;
+    }
+  }
+
+  double t = tBegin;
+  while (t < tEnd) {
+    const int axis = tNext[0] < tNext[1] ? 0 : 1;
+    const double tExit = std::min(tNext[axis], tEnd);
+
+    if (visit(static_cast<std::size_t>(cell[0]), static_cast<std::size_t>(cell[1]), t, tExit)) {
+      return true;
+    }
+
+    t = std::max(t, tExit);
+    cell[axis] += step[axis];
+    tNext[axis] += tDelta[axis];
+    if (cell[axis] < 0 || cell[axis] >= size[axis]) {
+      break;
+    }
+  }
+  return false;
+}
+
+} // namespace
+
+bool HeightmapRaycaster::raycast(const Heightmap& heightmap,
+                                 const Eigen::Vector3d& origin,
+                                 const Eigen::Vector3d& direction,
+                                 double maxRange,
+                                 double& range) {
+  const HeightmapParameters& params = heightmap.getParameters();
+
+  // Only the part of the ray below the highest point of the part can hit it
+  double tBegin = 0.0;
+  double tEnd = maxRange;
+  const double top = heightmap.maxHeight();
+  if (origin.z() > top) {
+    if (direction.z() >= 0.0) {
+      return false;
+    }
+    tBegin = (top - origin.z()) / direction.z();
+  } else if (direction.z() > 0.0) {
+    tEnd = std::min(tEnd, (top - origin.z()) / direction.z());
+  }
+
+  // Clip to the grid, in coordinates of the cells between four cell centers, where the surface is bilinear
+  const Eigen::Vector2d start =
+      (origin.head<2>() - params.origin) / params.resolution - Eigen::Vector2d::Constant(0.5);
+  const Eigen::Vector2d gridDirection = direction.head<2>() / params.resolution;
+  const std::size_t nbX = heightmap.getNbCellsX() - 1;
+  const std::size_t nbY = heightmap.getNbCellsY() - 1;
+  const double gridSize[2] = {static_cast<double>(nbX), static_cast<double>(nbY)};
+
+  double gridBegin = tBegin;
+  double gridEnd = tEnd;
+  for (int axis = 0; axis < 2; ++axis) {
+    if (gridDirection[axis] == 0.0) {
+      if (start[axis] < 0.0 || start[axis] >= gridSize[axis]) {
+        gridEnd = -INF;
+      }
+      continue;
+    }
+
+    double t0 = -start[axis] / gridDirection[axis];
+    double t1 = (gridSize[axis] - start[axis]) / gridDirection[axis];
+    if (t0 > t1) {
+      std::swap(t0, t1);
+    }
+    gridBegin = std::max(gridBegin, t0);
+    gridEnd = std::min(gridEnd, t1);
+  }
+
+  bool hit = false;
+  double tHit = 0.0;
+
+  if (gridBegin < gridEnd) {
+    const std::size_t tileSize = params.tileSize;
+    const std::size_t nbTilesX = heightmap.getNbTilesX();
+    const std::size_t nbTilesY = heightmap.getNbTilesY();
+
+    auto visitCell = [&](std::size_t ix, std::size_t iy, double ta, double tb) {
+      const double h00 = heightmap.cellHeight(ix, iy);
+      const double h10 = heightmap.cellHeight(ix + 1, iy);
+      const double h01 = heightmap.cellHeight(ix, iy + 1);
+      const double h11 = heightmap.cellHeight(ix + 1, iy + 1);
+      const double lowest = origin.z() + (direction.z() < 0.0 ? tb : ta) * direction.z();
+      if (lowest > std::max({h00, h10, h01, h11})) {
+        return false;
+      }
+
+      // Along the ray the bilinear surface is quadratic, height above it: a s^2 + b s + c with s = t - ta
+      const double u = start.x() + ta * gridDirection.x() - ix;
+      const double v = start.y() + ta * gridDirection.y() - iy;
+      const double du = gridDirection.x();
+      const double dv = gridDirection.y();
+      const double kx = h10 - h00;
+      const double ky = h01 - h00;
+      const double kxy = h00 - h10 - h01 + h11;
+
+      const double a = -kxy * du * dv;
+      const double b = direction.z() - (kx * du + ky * dv + kxy * (u * dv + v * du));
+      const double c = origin.z() + ta * direction.z() - (h00 + kx * u + ky * v + kxy * u * v);
+
+      if (c <= 0.0) {
+        tHit = ta;
+        return true;
+      }
+
+      double root = INF;
+      if (std::abs(a) < 1e-12) {
+        if (b < 0.0) {
+          root = -c / b;
+        }
+      } else {
+        const double discriminant = b * b - 4.0 * a * c;
+        if (discriminant >= 0.0) {
+          const double sqrtDiscriminant = std::sqrt(discriminant);
+          const double r0 = (-b - sqrtDiscriminant) / (2.0 * a);
+          const double r1 = (-b + sqrtDiscriminant) / (2.0 * a);
+          root = std::min(r0 >= 0.0 ? r0 : INF, r1 >= 0.0 ? r1 : INF);
+        }
+      }
+
+      if (ta + root <= tb) {
+        tHit = ta + root;
+        return true;
+      }
+      return false;
+    };
+
+    // Cells on the last row and column of a tile also depend on the next tiles
+    auto visitTile = [&](std::size_t tx, std::size_t ty, double ta, double tb) {
+      double highest = heightmap.tileMaxHeight(ty * nbTilesX + tx);
+      if (tx + 1 < nbTilesX) {
+        highest = std::max(highest, heightmap.tileMaxHeight(ty * nbTilesX + tx + 1));
+      }
+      if (ty + 1 < nbTilesY) {
+        highest = std::max(highest, heightmap.tileMaxHeight((ty + 1) * nbTilesX + tx));
+        if (tx + 1 < nbTilesX) {
+          highest = std::max(highest, heightmap.tileMaxHeight((ty + 1) * nbTilesX + tx + 1));
+        }
+      }
+
+      const double lowest = origin.z() + (direction.z() < 0.0 ? tb : ta) * direction.z();
+      if (lowest > highest) {
+        return false;
+      }
+      return walkGrid(start, gridDirection, ta, tb, nbX, nbY, visitCell);
+    };
+
+    hit = walkGrid(start / static_cast<double>(tileSize),
+                   gridDirection / static_cast<double>(tileSize),
+                   gridBegin,
+                   gridEnd,
+                   (nbX + tileSize - 1) / tileSize,
+                   (nbY + tileSize - 1) / tileSize,
+                   visitTile);
+  }
+
+  if (!hit && direction.z() < 0.0) {
+    // Substrate around the grid
+    tHit = (params.baseHeight - origin.z()) / direction.z();
+    hit = tHit >= 0.0 && tHit <= maxRange;
+  }
+
+  range = tHit;
+  return hit;
+}
+
+void HeightmapRaycaster::castFan(const Heightmap& heightmap,
+                                 const Eigen::Isometry3d& sensor,
+                                 const Eigen::Matrix3Xd& directions,
+                                 double minRange,
+                                 double maxRange,
+                                 Eigen::ArrayXd& ranges) {
+  partDirections_.noalias() = sensor.linear() * directions;
+  ranges.resize(directions.cols());
+
+  const Eigen::Vector3d origin = sensor.translation();
+  for (Eigen::Index i = 0; i < directions.cols(); ++i) {
+    double range = 0.0;
+    const bool hit = raycast(heightmap, origin, partDirections_.col(i), maxRange, range);
+    ranges[i] = (hit && range >= minRange) ? range : std::numeric_limits<double>::quiet_NaN();
+  }
+}
+
+} // namespace wp5_simulation
@@ -0,0 +1,34 @@
+/**
+ * @file HeightmapRegistry.cpp
+ * @brief Heightmaps of the simulated parts, shared between the plugins of a Gazebo server.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include "wp5_simulation/HeightmapRegistry.h"
+
+namespace wp5_simulation {
+
+HeightmapRegistry& HeightmapRegistry::instance() {
+  static HeightmapRegistry registry;
+  return registry;
+}
+
+void HeightmapRegistry::add(const std::string& name, const std::shared_ptr<SharedHeightmap>& heightmap) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  heightmaps_[name] = heightmap;
+}
+
+void HeightmapRegistry::remove(const std::string& name) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  heightmaps_.erase(name);
+}
+
+std::shared_ptr<SharedHeightmap> HeightmapRegistry::find(const std::string& name) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = heightmaps_.find(name);
+  return it != heightmaps_.end() ? it->second : nullptr;
+}
+
+} // namespace wp5_simulation
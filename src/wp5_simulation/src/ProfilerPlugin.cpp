@@ -0,0 +1,164 @@
+/**
+ * @file ProfilerPlugin.cpp
+ * @brief Gazebo model plugin simulating the laser line profiler on the CPU.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include "wp5_simulation/ProfilerPlugin.h"
+
+#include <sensor_msgs/point_cloud2_iterator.h>
+
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <shared_mutex>
+
+namespace wp5_simulation {
+
+namespace {
+
+template <typename T>
+T sdfParam(const sdf::ElementPtr& sdf, const std::string& name, const T& fallback) {
+  return sdf->Get<T>(name, fallback).first;
+}
+
+Eigen::Isometry3d toIsometry(const ignition::math::Pose3d& pose) {
+  Eigen::Isometry3d transform = Eigen::Isometry3d::Identity();
+  transform.translation() = Eigen::Vector3d(pose.Pos().X(), pose.Pos().Y(), pose.Pos().Z());
+  transform.linear() = Eigen::Quaterniond(pose.Rot().W(), pose.Rot().X(), pose.Rot().Y(), pose.Rot().Z())
+                           .normalized()
+                           .toRotationMatrix();
+  return transform;
+}
+
+} // namespace
+
+void ProfilerPlugin::Load(gazebo::physics::ModelPtr model, sdf::ElementPtr sdf) {
+  if (!ros::isInitialized()) {
+    ROS_FATAL("[ProfilerPlugin] - ROS is not initialized, load the plugin through gazebo_ros.");
+    return;
+  }
+
+  world_ = model->GetWorld();
+  const std::string linkName = sdfParam<std::string>(sdf, "link", "profiler");
+  link_ = model->GetLink(linkName);
+  if (!link_) {
+    ROS_FATAL_STREAM("[ProfilerPlugin] - No link " << linkName << " in model " << model->GetName() << ".");
+    return;
+  }
+
+  partLinkName_ = sdfParam<std::string>(sdf, "part_link", "");
+  heightmapName_ = sdfParam<std::string>(sdf, "heightmap_name", "part");
+
+  period_ = 1.0 / std::max(1.0, sdfParam(sdf, "update_rate", 1.0 / period_));
+  minRange_ = sdfParam(sdf, "min_range", minRange_);
+  maxRange_ = sdfParam(sdf, "max_range", maxRange_);
+  noiseStddev_ = sdfParam(sdf, "noise_stddev", noiseStddev_);
+  const ignition::math::Vector3d cameraOffset = sdfParam(sdf, "camera_offset", ignition::math::Vector3d::Zero);
+  cameraOffset_ = Eigen::Vector3d(cameraOffset.X(), cameraOffset.Y(), cameraOffset.Z());
+
+  generator_.seed(sdfParam(sdf, "seed", 0u));
+  noise_ = std::normal_distribution<double>(0.0, std::max(0.0, noiseStddev_));
+
+  // Laser fan in the xz plane of the profiler, looking along z
+  const int nbPoints = std::max(2, sdfParam(sdf, "nb_points", 640));
+  const double fov = sdfParam(sdf, "fov", 0.5);
+  directions_.resize(3, nbPoints);
+  for (int i = 0; i < nbPoints; ++i) {
+    const double angle = fov * (static_cast<double>(i) / (nbPoints - 1) - 0.5);
+    directions_.col(i) << std::sin(angle), 0.0, std::cos(angle);
+  }
+
+  nh_ = std::make_unique<ros::NodeHandle>(sdfParam<std::string>(sdf, "robot_namespace", "/"));
+  profilePub_ = nh_->advertise<sensor_msgs::PointCloud2>(sdfParam<std::string>(sdf, "topic", "profile"), 1);
+
+  ros::NodeHandle pnh(*nh_, linkName + "_profiler");
+  scanLoop_ = &metrics_.loop("scans");
+  scanDuration_ = &metrics_.histogram("scan");
+  metrics_.advertise(*nh_, pnh, ros::this_node::getName(), "Profiler plugin " + linkName);
+
+  profile_.header.frame_id = sdfParam<std::string>(sdf, "frame_id", linkName);
+  sensor_msgs::PointCloud2Modifier modifier(profile_);
+  modifier.setPointCloud2FieldsByString(1, "xyz");
+  modifier.resize(nbPoints);
+  profile_.height = 1;
+  profile_.width = nbPoints;
+  profile_.is_dense = false;
+
+  updateConnection_ = gazebo::event::Events::ConnectWorldUpdateBegin(
+      std::bind(&ProfilerPlugin::onUpdate_, this, std::placeholders::_1));
+}
+
+bool ProfilerPlugin::resolve_() {
+  if (!heightmap_) {
+    heightmap_ = HeightmapRegistry::instance().find(heightmapName_);
+  }
+  if (!partLinkName_.empty() && !partLink_) {
+    partLink_ = boost::dynamic_pointer_cast<gazebo::physics::Link>(world_->EntityByName(partLinkName_));
+  }
+  return heightmap_ && (partLinkName_.empty() || partLink_);
+}
+
+void ProfilerPlugin::onUpdate_(const gazebo::common::UpdateInfo& info) {
+  const double time = info.simTime.Double();
+  if (time - lastScan_ < period_ || !resolve_()) {
+    return;
+  }
+  lastScan_ = time;
+  scanLoop_->tick();
+  const ros::WallTime start = ros::WallTime::now();
+
+  Eigen::Isometry3d sensor = toIsometry(link_->WorldPose());
+  if (partLink_) {
+    sensor = toIsometry(partLink_->WorldPose()).inverse() * sensor;
+  }
+  const Eigen::Vector3d camera = sensor * cameraOffset_;
+  const bool checkOcclusion = !cameraOffset_.isZero();
+
+  {
+    std::shared_lock<std::shared_mutex> lock(heightmap_->mutex);
+    const Heightmap& heightmap = heightmap_->heightmap;
+    raycaster_.castFan(heightmap, sensor, directions_, minRange_, maxRange_, ranges_);
+
+    // A lit point the camera cannot see gives no measurement
+    if (checkOcclusion) {
+      for (Eigen::Index i = 0; i < ranges_.size(); ++i) {
+        if (std::isnan(ranges_[i])) {
+          continue;
+        }
+
+        const Eigen::Vector3d toPoint = sensor * (ranges_[i] * directions_.col(i)) - camera;
+        const double distance = toPoint.norm();
+        double range = 0.0;
+        if (HeightmapRaycaster::raycast(heightmap, camera, toPoint / distance, distance - 1e-4, range)) {
+          ranges_[i] = std::numeric_limits<double>::quiet_NaN();
+        }
+      }
+    }
+  }
+
+  profile_.header.stamp = ros::Time(info.simTime.sec, info.simTime.nsec);
+  sensor_msgs::PointCloud2Iterator<float> itX(profile_, "x");
+  sensor_msgs::PointCloud2Iterator<float> itY(profile_, "y");
+  sensor_msgs::PointCloud2Iterator<float> itZ(profile_, "z");
+  for (Eigen::Index i = 0; i < ranges_.size(); ++i, ++itX, ++itY, ++itZ) {
+    if (std::isnan(ranges_[i])) {
+      *itX = *itY = *itZ = std::numeric_limits<float>::quiet_NaN();
+      continue;
+    }
+
+    const double range = ranges_[i] + (noiseStddev_ > 0.0 ? noise_(generator_) : 0.0);
+    *itX = static_cast<float>(range * directions_(0, i));
+    *itY = 0.0f;
+    *itZ = static_cast<float>(range * directions_(2, i));
+  }
+
+  profilePub_.publish(profile_);
+  scanDuration_->record(static_cast<std::uint64_t>((ros::WallTime::now() - start).toNSec()));
+}
+
+GZ_REGISTER_MODEL_PLUGIN(ProfilerPlugin)
+
+} // namespace wp5_simulation
@@ -0,0 +1,113 @@
+/**
+ * @file simulated_welder_node.cpp
+ * @brief ROS node simulating the welder behind the Modbus driver, switching the arc on register writes.
+ *
+ * The arc follows the written register after the ignition or extinction delay of the welder, in simulated time, and
+ * its state is published on arc_state for the deposition plugin and the arc scheduler feedback. The lateness of the
+ * switches against simulated time shows whether the node keeps up with a run faster than real time.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include <ros/ros.h>
+#include <std_msgs/Bool.h>
+#include <wp5_common/Metrics.h>
+#include <wp5_msgs/ModbusWrite.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+
+namespace wp5_simulation {
+
+class SimulatedWelder {
+public:
+  SimulatedWelder(ros::NodeHandle& nh, ros::NodeHandle& pnh) : nh_(nh) {
+    device_ = pnh.param<std::string>("device", "welder");
+    address_ = pnh.param("address", 0);
+    ignitionDelay_ = pnh.param("ignition_delay", 0.01);
+    extinctionDelay_ = pnh.param("extinction_delay", 0.002);
+
+    droppedWrites_ = &metrics_.drops("Modbus writes");
+    switches_ = &metrics_.counter("arc switches");
+    replacedSwitches_ = &metrics_.counter("replaced pending switches");
+    switchLateness_ = &metrics_.histogram("switch lateness");
+    metrics_.advertise(nh, pnh, ros::this_node::getName(), "Simulated welder");
+
+    arcStatePub_ = nh.advertise<std_msgs::Bool>("arc_state", 8, true);
+    writeSub_ = nh.subscribe(
+        pnh.param<std::string>("write_topic", "modbus_write"), 8, &SimulatedWelder::writeCallback_, this);
+
+    publishState_(false);
+  }
+
+private:
+  void writeCallback_(const wp5_msgs::ModbusWriteConstPtr& msg) {
+    droppedWrites_->addSequenceGap(msg->header.seq);
+    if (msg->device != device_ || msg->address != address_ || msg->values.empty()) {
+      return;
+    }
+
+    const bool on = msg->values.front() != 0;
+    if (on == requested_) {
+      return;
+    }
+    requested_ = on;
+
+    // Replaces a switch still pending
+    if (pending_) {
+      replacedSwitches_->add();
+    }
+    pending_ = true;
+    switchTimer_ = nh_.createTimer(
+        ros::Duration(std::max(1e-6, on ? ignitionDelay_ : extinctionDelay_)),
+        [this, on](const ros::TimerEvent& event) {
+          // Simulated time elapsed past the switch before the callback ran
+          const std::int64_t lateness = (event.current_real - event.current_expected).toNSec();
+          switchLateness_->record(static_cast<std::uint64_t>(std::max<std::int64_t>(0, lateness)));
+          switches_->add();
+          pending_ = false;
+          publishState_(on);
+        },
+        true);
+  }
+
+  void publishState_(bool on) {
+    std_msgs::Bool state;
+    state.data = on;
+    arcStatePub_.publish(state);
+  }
+
+  ros::NodeHandle nh_;
+  std::string device_;
+  int address_ = 0;
+  double ignitionDelay_ = 0.01;   // [s]
+  double extinctionDelay_ = 0.002; // [s]
+
+  bool requested_ = false;
+  bool pending_ = false;
+  ros::Timer switchTimer_;
+
+  wp5_common::MetricsRegistry metrics_;
+  wp5_common::Counter* droppedWrites_ = nullptr;
+  wp5_common::Counter* switches_ = nullptr;
+  wp5_common::Counter* replacedSwitches_ = nullptr;
+  wp5_common::Histogram* switchLateness_ = nullptr;
+
+  ros::Subscriber writeSub_;
+  ros::Publisher arcStatePub_;
+};
+
+} // namespace wp5_simulation
+
+int main(int argc, char** argv) {
+  ros::init(argc, argv, "simulated_welder");
+  ros::NodeHandle nh;
+  ros::NodeHandle pnh("~");
+
+  wp5_simulation::SimulatedWelder welder(nh, pnh);
+  ros::spin();
+
+  return 0;
+}
@@ -0,0 +1,47 @@
+/**
+ * @file DwellPredictor.h
+ * @brief ROS service predicting the interpass dwell of each layer from the thermal model of the part.
+ *
+ * One thermal model is kept per part and follows its build: each call lets the part cool for the time elapsed since
+ * the previous layer, deposits the new layer along its path and returns the dwell after which the top layer is below
+ * the interpass temperature.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <ros/ros.h>
+#include <wp5_msgs/ComputeDwell.h>
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include "wp5_thermal/ThermalModel.h"
+
+namespace wp5_thermal {
+
+class DwellPredictor {
+public:
+  DwellPredictor(ros::NodeHandle& nh, ros::NodeHandle& pnh);
+
+  /**
+   * @brief Grid, material and temperatures of the model, as laid out in config/thermal_model.yaml.
+   */
+  static ThermalParameters readParameters(const ros::NodeHandle& pnh);
+
+private:
+  bool computeDwellCallback_(wp5_msgs::ComputeDwell::Request& req, wp5_msgs::ComputeDwell::Response& res);
+
+  ThermalParameters params_;
+  double interpassTemperature_ = 200.0; // [degC]
+  double maxDwell_ = 600.0;             // [s]
+
+  std::map<std::string, std::unique_ptr<ThermalModel>> models_;
+
+  ros::ServiceServer computeDwellService_;
+};
+
+} // namespace wp5_thermal
@@ -0,0 +1,111 @@
+/**
+ * @file ThermalModel.h
+ * @brief Reduced-order thermal model of the part, to predict the interpass dwell.
+ *
+ * The as-built part is a voxel grid on top of the substrate, whose bottom is held at the table temperature. Layers
+ * activate the voxels under the bead footprint at the deposition temperature, segment by segment at the deposition
+ * speed, and the temperature field evolves with an explicit finite-difference scheme: conduction between active
+ * voxels, convection and radiation on the exposed faces. Each step is split by slices along z across the threads of the
+ * task scheduler shared by the process. With voxels of a few millimeters, the cooling of a layer is predicted orders of
+ * magnitude faster than real time.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace wp5_thermal {
+
+struct ThermalParameters {
+  // Grid in the part frame, the substrate fills the bottom of the grid
+  double voxelSize = 2e-3;                      // [m]
+  Eigen::Vector3d origin{-0.1, -0.1, -0.01};    // Lower corner of the grid [m]
+  Eigen::Vector3d size{0.2, 0.2, 0.21};         // [m]
+  double substrateThickness = 0.01;             // [m]
+
+  // Material, steel by default
+  double density = 7850.0;     // [kg/m^3]
+  double specificHeat = 600.0; // [J/(kg K)]
+  double conductivity = 30.0;  // [W/(m K)]
+  double emissivity = 0.7;
+  double convection = 15.0; // [W/(m^2 K)]
+
+  double ambientTemperature = 25.0;      // [degC]
+  double tableTemperature = 25.0;        // Bottom of the substrate [degC]
+  double depositionTemperature = 1500.0; // [degC]
+
+  // Bead footprint activating the voxels
+  double beadWidth = 6e-3;   // [m]
+  double layerHeight = 2e-3; // [m]
+
+  std::size_t nbThreads = 0; // Threads of the shared task scheduler, 0 uses all of them
+};
+
+class ThermalModel {
+public:
+  explicit ThermalModel(const ThermalParameters& params = ThermalParameters());
+
+  /**
+   * @brief Deposit a layer along a path of the part frame, the model time advancing at the deposition speed.
+   *
+   * The voxels reached by the layer become the top layer, whose temperature decides the dwell.
+   */
+  void depositLayer(const std::vector<Eigen::Vector3d>& path, double speed);
+
+  /**
+   * @brief Let the part cool for the given duration [s].
+   */
+  void advance(double duration);
+
+  /**
+   * @brief Shortest dwell after which the top layer is below the interpass temperature, bounded by maxDwell [s].
+   *
+   * The model itself is left unchanged.
+   */
+  double predictDwell(double interpassTemperature, double maxDwell) const;
+
+  /**
+   * @brief Hottest voxel of the top layer [degC], ambient temperature before the first layer.
+   */
+  double topLayerTemperature() const;
+
+  double getTimeStep() const { return timeStep_; }
+  std::size_t getNbActiveVoxels() const { return nbActive_; }
+  const ThermalParameters& getParameters() const { return params_; }
+
+private:
+  /**
+   * @brief Advance the field by up to duration, stopping as soon as the top layer is below stopTemperature.
+   *
+   * @return Simulated time [s].
+   */
+  double run_(double duration, double stopTemperature);
+
+  void activateSegment_(const Eigen::Vector3d& from, const Eigen::Vector3d& to);
+  std::size_t index_(std::size_t ix, std::size_t iy, std::size_t iz) const { return (iz * ny_ + iy) * nx_ + ix; }
+
+  ThermalParameters params_;
+  std::size_t nx_ = 0;
+  std::size_t ny_ = 0;
+  std::size_t nz_ = 0;
+  std::size_t nbActive_ = 0;
+  std::size_t topSlice_ = 0; // Slices above are empty
+
+  double timeStep_ = 0.0;   // Largest stable explicit step [s]
+  double diffusion_ = 0.0;  // Thermal diffusivity over the squared voxel size [1/s]
+  double surfaceLoss_ = 0.0; // Exposed face area over the voxel heat capacity [m^2 K/J]
+
+  std::vector<double> temperature_;
+  std::vector<double> next_;
+  std::vector<std::uint8_t> active_;
+  std::vector<std::uint8_t> top_;
+  std::vector<std::size_t> topVoxels_;
+};
+
+} // namespace wp5_thermal
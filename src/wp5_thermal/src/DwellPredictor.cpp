@@ -0,0 +1,115 @@
+/**
+ * @file DwellPredictor.cpp
+ * @brief ROS service predicting the interpass dwell of each layer from the thermal model of the part.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include "wp5_thermal/DwellPredictor.h"
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <stdexcept>
+#include <vector>
+
+namespace wp5_thermal {
+
+namespace {
+
+Eigen::Vector3d readVector(const ros::NodeHandle& pnh, const std::string& name, const Eigen::Vector3d& fallback) {
+  std::vector<double> values;
+  if (!pnh.getParam(name, values)) {
+    return fallback;
+  }
+  if (values.size() != 3) {
+    throw std::invalid_argument("[DwellPredictor] - Parameter " + name + " must have 3 values.");
+  }
+  return Eigen::Vector3d(values[0], values[1], values[2]);
+}
+
+} // namespace
+
+DwellPredictor::DwellPredictor(ros::NodeHandle& nh, ros::NodeHandle& pnh) : params_(readParameters(pnh)) {
+  interpassTemperature_ = pnh.param("interpass_temperature", interpassTemperature_);
+  maxDwell_ = pnh.param("max_dwell", maxDwell_);
+
+  // Fails early on an invalid grid or material, before the first part
+  const ThermalModel model(params_);
+  ROS_INFO_STREAM("[DwellPredictor] - Voxels of " << params_.voxelSize * 1e3 << " mm, time step of "
+                                                  << model.getTimeStep() << " s.");
+
+  computeDwellService_ = nh.advertiseService("compute_dwell", &DwellPredictor::computeDwellCallback_, this);
+}
+
+ThermalParameters DwellPredictor::readParameters(const ros::NodeHandle& pnh) {
+  ThermalParameters params;
+  params.voxelSize = pnh.param("grid/voxel_size", params.voxelSize);
+  params.origin = readVector(pnh, "grid/origin", params.origin);
+  params.size = readVector(pnh, "grid/size", params.size);
+  params.substrateThickness = pnh.param("grid/substrate_thickness", params.substrateThickness);
+
+  params.density = pnh.param("material/density", params.density);
+  params.specificHeat = pnh.param("material/specific_heat", params.specificHeat);
+  params.conductivity = pnh.param("material/conductivity", params.conductivity);
+  params.emissivity = pnh.param("material/emissivity", params.emissivity);
+  params.convection = pnh.param("convection", params.convection);
+
+  params.ambientTemperature = pnh.param("temperatures/ambient", params.ambientTemperature);
+  params.tableTemperature = pnh.param("temperatures/table", params.tableTemperature);
+  params.depositionTemperature = pnh.param("temperatures/deposition", params.depositionTemperature);
+
+  params.beadWidth = pnh.param("bead/width", params.beadWidth);
+  params.layerHeight = pnh.param("bead/layer_height", params.layerHeight);
+
+  params.nbThreads = static_cast<std::size_t>(std::max(0, pnh.param("nb_threads", 0)));
+  return params;
+}
+
+bool DwellPredictor::computeDwellCallback_(wp5_msgs::ComputeDwell::Request& req,
+                                           wp5_msgs::ComputeDwell::Response& res) {
+  if (req.path.poses.empty() || req.deposition_speed <= 0.0) {
+    res.success = false;
+    res.message = "Empty path or non positive deposition speed.";
+    return true;
+  }
+
+  try {
+    std::unique_ptr<ThermalModel>& model = models_[req.part];
+    if (!model || req.reset) {
+      model = std::make_unique<ThermalModel>(params_);
+    }
+
+    std::vector<Eigen::Vector3d> path;
+    path.reserve(req.path.poses.size());
+    for (const geometry_msgs::Pose& pose : req.path.poses) {
+      path.emplace_back(pose.position.x, pose.position.y, pose.position.z);
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    model->advance(req.elapsed);
+    model->depositLayer(path, req.deposition_speed);
+    res.peak_temperature = model->topLayerTemperature();
+    res.dwell = model->predictDwell(interpassTemperature_, maxDwell_);
+    const std::chrono::duration<double> computation = std::chrono::steady_clock::now() - start;
+
+    res.success = true;
+    if (res.dwell >= maxDwell_) {
+      res.message = "Interpass temperature not reached within the maximum dwell.";
+      ROS_WARN_STREAM("[DwellPredictor] - Part " << req.part << " still above " << interpassTemperature_
+                                                 << " degC after " << maxDwell_ << " s.");
+    }
+
+    ROS_INFO_STREAM("[DwellPredictor] - Part " << req.part << ", layer at " << res.peak_temperature
+                                               << " degC, dwell of " << res.dwell << " s, computed in "
+                                               << computation.count() << " s.");
+  } catch (const std::exception& e) {
+    res.success = false;
+    res.message = e.what();
+  }
+
+  return true;
+}
+
+} // namespace wp5_thermal
@@ -0,0 +1,276 @@
+/**
+ * @file ThermalModel.cpp
+ * @brief Reduced-order thermal model of the part, to predict the interpass dwell.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include "wp5_thermal/ThermalModel.h"
+
+#include <wp5_common/TaskScheduler.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace wp5_thermal {
+
+namespace {
+
+constexpr double STEFAN_BOLTZMANN = 5.670374419e-8; // [W/(m^2 K^4)]
+constexpr double KELVIN = 273.15;
+
+// Slices per worker below which threads cost more than they save
+constexpr std::size_t MIN_SLICES_PER_THREAD = 4;
+
+} // namespace
+
+ThermalModel::ThermalModel(const ThermalParameters& params) : params_(params) {
+  if (params_.voxelSize <= 0.0 || (params_.size.array() < params_.voxelSize).any()) {
+    throw std::invalid_argument("Voxel size must be positive and smaller than the grid.");
+  }
+  if (params_.density <= 0.0 || params_.specificHeat <= 0.0 || params_.conductivity <= 0.0) {
+    throw std::invalid_argument("Density, specific heat and conductivity must be positive.");
+  }
+
+  nx_ = static_cast<std::size_t>(std::ceil(params_.size.x() / params_.voxelSize));
+  ny_ = static_cast<std::size_t>(std::ceil(params_.size.y() / params_.voxelSize));
+  nz_ = static_cast<std::size_t>(std::ceil(params_.size.z() / params_.voxelSize));
+
+  const std::size_t nbVoxels = nx_ * ny_ * nz_;
+  temperature_.assign(nbVoxels, params_.ambientTemperature);
+  next_.assign(nbVoxels, params_.ambientTemperature);
+  active_.assign(nbVoxels, 0);
+  top_.assign(nbVoxels, 0);
+
+  // Substrate, the slices whose center is below its top
+  const std::size_t nbSubstrate = std::min(
+      nz_, static_cast<std::size_t>(std::max(0.0, std::round(params_.substrateThickness / params_.voxelSize))));
+  std::fill(active_.begin(), active_.begin() + nbSubstrate * nx_ * ny_, 1);
+  std::fill(temperature_.begin(), temperature_.begin() + nbSubstrate * nx_ * ny_, params_.tableTemperature);
+  nbActive_ = nbSubstrate * nx_ * ny_;
+  topSlice_ = nbSubstrate;
+
+  // Largest stable step, for the hottest voxel exposed on five faces
+  const double dx = params_.voxelSize;
+  const double heatCapacity = params_.density * params_.specificHeat;
+  diffusion_ = params_.conductivity / (heatCapacity * dx * dx);
+  surfaceLoss_ = 1.0 / (heatCapacity * dx);
+
+  const double hot = params_.depositionTemperature + KELVIN;
+  const double ambient = params_.ambientTemperature + KELVIN;
+  const double maxLoss =
+      params_.convection + params_.emissivity * STEFAN_BOLTZMANN * (hot * hot + ambient * ambient) * (hot + ambient);
+  timeStep_ = 0.9 / (6.0 * diffusion_ + 5.0 * maxLoss * surfaceLoss_);
+}
+
+void ThermalModel::depositLayer(const std::vector<Eigen::Vector3d>& path, double speed) {
+  if (speed <= 0.0) {
+    throw std::invalid_argument("Deposition speed must be positive.");
+  }
+
+  for (std::size_t voxel : topVoxels_) {
+    top_[voxel] = 0;
+  }
+  topVoxels_.clear();
+
+  // The field evolves while the layer is built, in chunks of a few steps
+  const double chunk = 10.0 * timeStep_;
+  double pending = 0.0;
+  for (std::size_t i = 1; i < path.size(); ++i) {
+    activateSegment_(path[i - 1], path[i]);
+
+    pending += (path[i] - path[i - 1]).norm() / speed;
+    if (pending >= chunk) {
+      run_(pending, -std::numeric_limits<double>::infinity());
+      pending = 0.0;
+    }
+  }
+
+  if (path.size() == 1) {
+    activateSegment_(path.front(), path.front());
+  }
+  if (pending > 0.0) {
+    run_(pending, -std::numeric_limits<double>::infinity());
+  }
+}
+
+void ThermalModel::advance(double duration) {
+  if (duration > 0.0) {
+    run_(duration, -std::numeric_limits<double>::infinity());
+  }
+}
+
+double ThermalModel::predictDwell(double interpassTemperature, double maxDwell) const {
+  if (topLayerTemperature() <= interpassTemperature || maxDwell <= 0.0) {
+    return 0.0;
+  }
+
+  ThermalModel cooling(*this);
+  return cooling.run_(maxDwell, interpassTemperature);
+}
+
+double ThermalModel::topLayerTemperature() const {
+  if (topVoxels_.empty()) {
+    return params_.ambientTemperature;
+  }
+
+  double hottest = -std::numeric_limits<double>::infinity();
+  for (std::size_t voxel : topVoxels_) {
+    hottest = std::max(hottest, temperature_[voxel]);
+  }
+  return hottest;
+}
+
+void ThermalModel::activateSegment_(const Eigen::Vector3d& from, const Eigen::Vector3d& to) {
+  const double dx = params_.voxelSize;
+  const double halfWidth = std::max(0.5 * params_.beadWidth, 0.5 * dx);
+  const double halfHeight = std::max(0.5 * params_.layerHeight, 0.5 * dx);
+
+  // Voxels around the segment, in grid coordinates
+  const Eigen::Vector3d margin(halfWidth, halfWidth, halfHeight);
+  const Eigen::Vector3d lower = (from.cwiseMin(to) - margin - params_.origin) / dx;
+  const Eigen::Vector3d upper = (from.cwiseMax(to) + margin - params_.origin) / dx;
+  const std::size_t n[3] = {nx_, ny_, nz_};
+  std::size_t begin[3], end[3];
+  for (int axis = 0; axis < 3; ++axis) {
+    begin[axis] = static_cast<std::size_t>(std::clamp(std::floor(lower[axis]), 0.0, static_cast<double>(n[axis])));
+    end[axis] = static_cast<std::size_t>(std::clamp(std::ceil(upper[axis]), 0.0, static_cast<double>(n[axis])));
+  }
+
+  const Eigen::Vector2d segment = (to - from).head<2>();
+  const double squaredLength = segment.squaredNorm();
+
+  for (std::size_t iz = begin[2]; iz < end[2]; ++iz) {
+    for (std::size_t iy = begin[1]; iy < end[1]; ++iy) {
+      for (std::size_t ix = begin[0]; ix < end[0]; ++ix) {
+        const Eigen::Vector3d center = params_.origin + dx * Eigen::Vector3d(ix + 0.5, iy + 0.5, iz + 0.5);
+        const double t =
+            squaredLength > 0.0 ? std::clamp((center - from).head<2>().dot(segment) / squaredLength, 0.0, 1.0) : 0.0;
+        const Eigen::Vector3d closest = from + t * (to - from);
+        if ((center - closest).head<2>().norm() > halfWidth || std::abs(center.z() - closest.z()) > halfHeight) {
+          continue;
+        }
+
+        const std::size_t voxel = index_(ix, iy, iz);
+        if (!active_[voxel]) {
+          active_[voxel] = 1;
+          temperature_[voxel] = params_.depositionTemperature;
+          ++nbActive_;
+          topSlice_ = std::max(topSlice_, iz + 1);
+        }
+        if (!top_[voxel]) {
+          top_[voxel] = 1;
+          topVoxels_.push_back(voxel);
+        }
+      }
+    }
+  }
+}
+
+double ThermalModel::run_(double duration, double stopTemperature) {
+  const std::size_t nbSteps = static_cast<std::size_t>(std::ceil(duration / timeStep_));
+  if (nbSteps == 0 || topSlice_ == 0) {
+    return 0.0;
+  }
+  const double dt = duration / static_cast<double>(nbSteps);
+  const bool checkStop = std::isfinite(stopTemperature);
+
+  wp5_common::TaskScheduler& scheduler = wp5_common::TaskScheduler::instance();
+  const std::size_t nbThreads = std::max<std::size_t>(
+      1,
+      std::min({params_.nbThreads ? params_.nbThreads : scheduler.getNbThreads(),
+                scheduler.getNbThreads(),
+                topSlice_ / MIN_SLICES_PER_THREAD}));
+
+  const std::size_t slice = nx_ * ny_;
+  const double ambient = params_.ambientTemperature;
+  const double ambientKelvin = ambient + KELVIN;
+  const double emissivity = params_.emissivity * STEFAN_BOLTZMANN;
+
+  // Hottest top voxel of each worker, gathered at the end of the step
+  std::vector<double> topMaximum(nbThreads, -std::numeric_limits<double>::infinity());
+  std::size_t step = 0;
+  bool stop = false;
+
+  auto update = [&](std::size_t firstSlice, std::size_t endSlice, std::size_t worker) {
+    double hottest = -std::numeric_limits<double>::infinity();
+
+    for (std::size_t iz = firstSlice; iz < endSlice; ++iz) {
+      for (std::size_t iy = 0; iy < ny_; ++iy) {
+        std::size_t voxel = index_(0, iy, iz);
+        for (std::size_t ix = 0; ix < nx_; ++ix, ++voxel) {
+          const double temperature = temperature_[voxel];
+          if (!active_[voxel]) {
+            next_[voxel] = temperature;
+            continue;
+          }
+
+          // Conduction with the active neighbours, the table under the bottom slice, the air elsewhere
+          double conduction = 0.0;
+          int nbExposed = 0;
+          auto neighbour = [&](bool inside, std::size_t other) {
+            if (inside && active_[other]) {
+              conduction += temperature_[other] - temperature;
+            } else {
+              ++nbExposed;
+            }
+          };
+          neighbour(ix > 0, voxel - 1);
+          neighbour(ix + 1 < nx_, voxel + 1);
+          neighbour(iy > 0, voxel - nx_);
+          neighbour(iy + 1 < ny_, voxel + nx_);
+          neighbour(iz + 1 < nz_, voxel + slice);
+          if (iz > 0) {
+            neighbour(true, voxel - slice);
+          } else {
+            conduction += params_.tableTemperature - temperature;
+          }
+
+          double loss = 0.0;
+          if (nbExposed > 0) {
+            const double kelvin = temperature + KELVIN;
+            const double radiation =
+                emissivity * (kelvin * kelvin + ambientKelvin * ambientKelvin) * (kelvin + ambientKelvin);
+            loss = nbExposed * (params_.convection + radiation) * surfaceLoss_ * (temperature - ambient);
+          }
+
+          const double updated = temperature + dt * (diffusion_ * conduction - loss);
+          next_[voxel] = updated;
+          if (top_[voxel]) {
+            hottest = std::max(hottest, updated);
+          }
+        }
+      }
+    }
+
+    topMaximum[worker] = hottest;
+  };
+
+  // Workers of the shared task scheduler update their slices, the calling thread swaps the fields and decides whether
+  // to go on once every slice is done
+  while (!stop) {
+    scheduler.parallelFor(
+        0,
+        nbThreads,
+        [&](std::size_t worker) {
+          update(worker * topSlice_ / nbThreads, (worker + 1) * topSlice_ / nbThreads, worker);
+        },
+        nbThreads);
+
+    temperature_.swap(next_);
+    ++step;
+
+    if (step == nbSteps) {
+      stop = true;
+    } else if (checkStop) {
+      stop = *std::max_element(topMaximum.begin(), topMaximum.end()) <= stopTemperature;
+    }
+  }
+
+  return step * dt;
+}
+
+} // namespace wp5_thermal
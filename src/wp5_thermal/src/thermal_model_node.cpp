@@ -0,0 +1,22 @@
+/**
+ * @file thermal_model_node.cpp
+ * @brief ROS node predicting the interpass dwell of each layer from the thermal model of the part.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include <ros/ros.h>
+
+#include "wp5_thermal/DwellPredictor.h"
+
+int main(int argc, char** argv) {
+  ros::init(argc, argv, "thermal_model");
+  ros::NodeHandle nh;
+  ros::NodeHandle pnh("~");
+
+  wp5_thermal::DwellPredictor predictor(nh, pnh);
+  ros::spin();
+
+  return 0;
+}
@@ -0,0 +1,92 @@
+/**
+ * @file test_thermal_model.cpp
+ * @brief Unit tests of the layerwise thermal model and its dwell prediction.
+ *
+ * @author lmunier - <lmunier@protonmail.com>
+ * @date 2026-10-17
+ */
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <vector>
+
+#include "wp5_thermal/ThermalModel.h"
+
+namespace wp5_thermal {
+
+namespace {
+
+// Coarse grid, so that each test runs in a fraction of a second
+ThermalParameters smallPart() {
+  ThermalParameters params;
+  params.voxelSize = 4e-3;
+  params.origin = Eigen::Vector3d(-0.04, -0.04, -0.008);
+  params.size = Eigen::Vector3d(0.08, 0.08, 0.04);
+  params.substrateThickness = 0.008;
+  params.beadWidth = 6e-3;
+  params.layerHeight = 4e-3;
+  params.nbThreads = 1;
+  return params;
+}
+
+std::vector<Eigen::Vector3d> line(double z) { return {{-0.02, 0.0, z}, {0.02, 0.0, z}}; }
+
+} // namespace
+
+TEST(ThermalModel, RejectsInvalidParameters) {
+  ThermalParameters params = smallPart();
+  params.voxelSize = 0.0;
+  EXPECT_THROW(ThermalModel{params}, std::invalid_argument);
+
+  params = smallPart();
+  params.conductivity = -1.0;
+  EXPECT_THROW(ThermalModel{params}, std::invalid_argument);
+
+  ThermalModel model(smallPart());
+  EXPECT_THROW(model.depositLayer(line(0.002), 0.0), std::invalid_argument);
+}
+
+TEST(ThermalModel, LayerHeatsThenCools) {
+  ThermalModel model(smallPart());
+  const std::size_t substrate = model.getNbActiveVoxels();
+  EXPECT_DOUBLE_EQ(model.topLayerTemperature(), smallPart().ambientTemperature);
+
+  model.depositLayer(line(0.002), 0.01);
+  EXPECT_GT(model.getNbActiveVoxels(), substrate);
+
+  const double hot = model.topLayerTemperature();
+  EXPECT_GT(hot, 400.0);
+  EXPECT_LE(hot, smallPart().depositionTemperature);
+
+  model.advance(5.0);
+  const double cooled = model.topLayerTemperature();
+  EXPECT_LT(cooled, hot);
+  EXPECT_GT(cooled, smallPart().ambientTemperature);
+}
+
+TEST(ThermalModel, PredictedDwellReachesInterpass) {
+  ThermalModel model(smallPart());
+  model.depositLayer(line(0.002), 0.01);
+  const double hot = model.topLayerTemperature();
+
+  const double dwell = model.predictDwell(400.0, 600.0);
+  EXPECT_GT(dwell, 0.0);
+  EXPECT_LT(dwell, 600.0);
+
+  // The prediction leaves the model untouched
+  EXPECT_DOUBLE_EQ(model.topLayerTemperature(), hot);
+
+  model.advance(dwell);
+  EXPECT_LE(model.topLayerTemperature(), 400.0 + 1e-6);
+}
+
+TEST(ThermalModel, DwellIsBoundedAndZeroWhenCold) {
+  ThermalModel model(smallPart());
+  model.depositLayer(line(0.002), 0.01);
+
+  EXPECT_DOUBLE_EQ(model.predictDwell(2000.0, 600.0), 0.0);
+  EXPECT_NEAR(model.predictDwell(30.0, 1.0), 1.0, model.getTimeStep());
+}
+
+} // namespace wp5_thermal